@@ -0,0 +1,258 @@
+/*
+ * board_access_probe.cpp
+ *
+ *  Created on: Oct 12, 2020
+ */
+
+#include <chrono>
+#include <boost/bind.hpp>
+#include <boost/format.hpp>
+
+#include "board_access_probe.h"
+#include "InfnLogger.h"
+
+#define DBG 0
+#if DBG
+#define DLOG INFN_LOG(SeverityLevel::info)
+#else
+#define DLOG INFN_LOG(SeverityLevel::debug)
+#endif
+
+namespace boardAda
+{
+using namespace boardMs;
+
+const uint32 AccessProbeEngine::cProbeReadsPerCycle;
+const uint32 AccessProbeEngine::cProbeCycleBudget;
+const uint32 AccessProbeEngine::cMaxHungCycles;
+
+AccessProbeEngine::AccessProbeEngine()
+    : mNumCycles(0)
+    , mNumLateCycles(0)
+    , mIsStarted(false)
+    , mThrdExit(false)
+{
+}
+
+AccessProbeEngine::~AccessProbeEngine()
+{
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        mThrdExit = true;
+    }
+    mCondReq.notify_all();
+
+    // Workers use this engine until they see the exit
+    for (uint32 i = 0; i < NUM_REG_BUSES; ++i)
+    {
+        if (mBus[i].mThr.joinable())
+        {
+            mBus[i].mThr.join();
+        }
+    }
+}
+
+void AccessProbeEngine::AddProbe(BoardAccessFault* pFault)
+{
+    RegBusType bus = pFault->GetBus();
+
+    DLOG << "Probe for fault: " << pFault->GetFaultId()
+         << " on bus: " << BoardRegStats::BusToStr(bus);
+
+    pFault->SetProbeEngineEnable(true);
+
+    std::lock_guard<std::mutex> guard(mLock);
+    mBus[bus].mvProbes.push_back(pFault);
+}
+
+void AccessProbeEngine::Start()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if (mIsStarted)
+    {
+        return;
+    }
+
+    for (uint32 i = 0; i < NUM_REG_BUSES; ++i)
+    {
+        if (mBus[i].mvProbes.empty())
+        {
+            continue;
+        }
+
+        INFN_LOG(SeverityLevel::info) << "Starting access probe worker for bus: "
+                                      << BoardRegStats::BusToStr(RegBusType(i))
+                                      << " probes: " << mBus[i].mvProbes.size();
+
+        mBus[i].mThr = boost::thread(boost::bind(
+                &AccessProbeEngine::ProbeWorker, this, RegBusType(i)
+                ));
+    }
+
+    mIsStarted = true;
+}
+
+void AccessProbeEngine::RunCycle()
+{
+    // Bitmask of RegBusType; no allocation on the fault path
+    uint32 kickedBuses = 0;
+
+    std::unique_lock<std::mutex> lock(mLock);
+
+    if (!mIsStarted)
+    {
+        return;
+    }
+
+    mNumCycles++;
+
+    for (uint32 i = 0; i < NUM_REG_BUSES; ++i)
+    {
+        ProbeBus& probeBus = mBus[i];
+
+        if (probeBus.mvProbes.empty())
+        {
+            continue;
+        }
+
+        if (probeBus.mCycleDone == probeBus.mCycleReq)
+        {
+            // Idle - kick next round
+            probeBus.mHungCycles = 0;
+            probeBus.mCycleReq++;
+            kickedBuses |= (1 << i);
+            continue;
+        }
+
+        // Still busy with an earlier round
+        probeBus.mNumOverruns++;
+
+        if (++probeBus.mHungCycles == cMaxHungCycles)
+        {
+            INFN_LOG(SeverityLevel::error) << "Access probe bus: "
+                                           << BoardRegStats::BusToStr(RegBusType(i))
+                                           << " not responding for "
+                                           << cMaxHungCycles << " cycles";
+
+            for (auto pFault : probeBus.mvProbes)
+            {
+                pFault->SetProbeHung();
+            }
+        }
+    }
+
+    if (kickedBuses == 0)
+    {
+        return;
+    }
+
+    mCondReq.notify_all();
+
+    auto deadline = std::chrono::steady_clock::now()
+                  + std::chrono::milliseconds(cProbeCycleBudget);
+
+    if (!mCondDone.wait_until(lock, deadline,
+                              [&]{ return IsCycleDone(kickedBuses); }))
+    {
+        // Late buses are picked up on a later cycle
+        mNumLateCycles++;
+    }
+}
+
+bool AccessProbeEngine::IsCycleDone(uint32 kickedBuses)
+{
+    for (uint32 i = 0; i < NUM_REG_BUSES; ++i)
+    {
+        if ((kickedBuses & (1 << i)) &&
+            (mBus[i].mCycleDone != mBus[i].mCycleReq))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void AccessProbeEngine::ProbeWorker(RegBusType bus)
+{
+    ProbeBus& probeBus = mBus[bus];
+
+    while (true)
+    {
+        uint64 cycleReq;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+
+            mCondReq.wait(lock, [&]{ return mThrdExit ||
+                                     (probeBus.mCycleDone != probeBus.mCycleReq); });
+            if (mThrdExit)
+            {
+                break;
+            }
+
+            cycleReq = probeBus.mCycleReq;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        // Probe list is fixed after Start(); no lock needed for bus access
+        for (uint32 n = 0; n < cProbeReadsPerCycle; ++n)
+        {
+            for (auto pFault : probeBus.mvProbes)
+            {
+                pFault->ProbeOnce();
+            }
+        }
+
+        uint32 durUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start).count();
+
+        {
+            std::lock_guard<std::mutex> guard(mLock);
+
+            probeBus.mCycleDone      = cycleReq;
+            probeBus.mLastDurationUs = durUs;
+            if (durUs > probeBus.mMaxDurationUs)
+            {
+                probeBus.mMaxDurationUs = durUs;
+            }
+        }
+
+        mCondDone.notify_all();
+    }
+
+    INFN_LOG(SeverityLevel::info) << "Access probe worker: " << BoardRegStats::BusToStr(bus) << " finished";
+}
+
+void AccessProbeEngine::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< AccessProbeEngine.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    os << "Cycles: " << mNumCycles << " Late cycles: " << mNumLateCycles
+       << " Budget: " << cProbeCycleBudget << " ms"
+       << " Reads/cycle: " << cProbeReadsPerCycle << std::endl << std::endl;
+
+    os << boost::format("%-8s : %6s : %10s : %10s : %8s : %8s : %12s : %12s")
+          % "Bus" % "Probes" % "Requested" % "Done" % "Overrun" % "Hung"
+          % "LastDur(us)" % "MaxDur(us)" << std::endl;
+
+    for (uint32 i = 0; i < NUM_REG_BUSES; ++i)
+    {
+        const ProbeBus& probeBus = mBus[i];
+
+        os << boost::format("%-8s : %6d : %10d : %10d : %8d : %8d : %12d : %12d")
+              % BoardRegStats::BusToStr(RegBusType(i))
+              % probeBus.mvProbes.size()
+              % probeBus.mCycleReq
+              % probeBus.mCycleDone
+              % probeBus.mNumOverruns
+              % probeBus.mHungCycles
+              % probeBus.mLastDurationUs
+              % probeBus.mMaxDurationUs << std::endl;
+    }
+}
+
+} // namespace boardAda
@@ -0,0 +1,102 @@
+/*
+ * board_access_probe.h
+ *
+ *  Created on: Oct 12, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_ADAPTER_BOARD_ACCESS_PROBE_H_
+#define CHM6_BOARD_MS_SRC_ADAPTER_BOARD_ACCESS_PROBE_H_
+
+#include <iostream>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <boost/thread.hpp>
+
+#include "types.h"
+#include "board_fault_defs.h"
+
+namespace boardAda
+{
+
+/*
+ * Each bus carrying runtime access faults gets its own probe worker
+ * so probes on different buses overlap. Probes go on the bus their
+ * fault is arbitrated on.
+ */
+class AccessProbeEngine
+{
+public:
+
+    AccessProbeEngine();
+
+    ~AccessProbeEngine();
+
+    void AddProbe(boardMs::BoardAccessFault* pFault);
+
+    // Start one worker per bus that has probes
+    void Start();
+
+    /*
+     * Kick one probe round on every idle bus and wait for it,
+     * bounded by cProbeCycleBudget. A bus still busy from an earlier
+     * round is skipped; once busy for cMaxHungCycles its faults are set.
+     */
+    void RunCycle();
+
+    void Dump(std::ostream& os);
+
+    static const uint32 cProbeReadsPerCycle = 2;
+    static const uint32 cProbeCycleBudget   = 200; // ms
+    static const uint32 cMaxHungCycles      = 3;
+
+private:
+
+    struct ProbeBus
+    {
+        ProbeBus()
+        : mCycleReq(0)
+        , mCycleDone(0)
+        , mHungCycles(0)
+        , mNumOverruns(0)
+        , mLastDurationUs(0)
+        , mMaxDurationUs(0)
+        {}
+
+        std::vector<boardMs::BoardAccessFault*> mvProbes;
+
+        boost::thread mThr;
+
+        uint64 mCycleReq;
+        uint64 mCycleDone;
+        uint32 mHungCycles;
+        uint32 mNumOverruns;
+        uint32 mLastDurationUs;
+        uint32 mMaxDurationUs;
+    };
+
+    void ProbeWorker(RegBusType bus);
+
+    bool IsCycleDone(uint32 kickedBuses);
+
+    ProbeBus mBus[NUM_REG_BUSES];
+
+    std::mutex mLock;
+
+    std::condition_variable mCondReq;
+
+    std::condition_variable mCondDone;
+
+    uint64 mNumCycles;
+
+    uint64 mNumLateCycles;
+
+    bool mIsStarted;
+
+    bool mThrdExit;
+};
+
+} // namespace boardAda
+
+#endif /* CHM6_BOARD_MS_SRC_ADAPTER_BOARD_ACCESS_PROBE_H_ */
@@ -5,6 +5,7 @@
  */
 
 #include <iomanip>
+#include <boost/bind.hpp>
 
 #include "board_adapter.h"
 #include "InfnLogger.h"
@@ -21,9 +22,14 @@ namespace boardAda
 {
 using namespace boardMs;
 
+const uint32 cFaultIrqWaitTimeout = 1000; // ms
+const uint32 cFaultIrqErrDelay    = 1000; // ms
+
 BoardAdapter::BoardAdapter(BoardDriver& boardDriver)
     : BoardCommonAdapter()
     , mDriver(boardDriver)
+    , mNumFaultIrqs(0)
+    , mThrFaultIrqExit(false)
 {
     std::ostringstream  log;
     log << " Created!";
@@ -35,7 +41,13 @@ BoardAdapter::BoardAdapter(BoardDriver& boardDriver)
 
 BoardAdapter::~BoardAdapter()
 {
+    mThrFaultIrqExit = true;
 
+    if (mThrFaultIrq.joinable())
+    {
+        mDriver.GetBrdCmnDriver()->WakeFaultIrq();
+        mThrFaultIrq.join();
+    }
 }
 
 void BoardAdapter::SetSlotId(uint32 slotId)
@@ -57,10 +69,8 @@ int BoardAdapter::SetHostBoardAction(hostBoardActionType action)
 {
     mLastBoardAction = action;
 
-    std::ostringstream  log;
-    log << "mLastBoardAction = " << HostBoardActionTypeToStr(mLastBoardAction);
-    AddLog(__func__, __LINE__, log.str());
-    INFN_LOG(SeverityLevel::info) << log.str();
+    BRD_TRACE(mTrace, "mLastBoardAction = %d", mLastBoardAction);
+    INFN_LOG(SeverityLevel::info) << "mLastBoardAction = " << HostBoardActionTypeToStr(mLastBoardAction);
 
     if (action == POWER_UP)
     {
@@ -139,11 +149,15 @@ LedStateType BoardAdapter::GetPowerLedState()
 
 void BoardAdapter::SetFaultLedState(LedStateType state)
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     mDriver.SetFruFaultLedState(state);
 }
 
 LedStateType BoardAdapter::GetFaultLedState()
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     if (mIsLedLampTestOn == true)
     {
         mFaultLedState = CYCLING;
@@ -162,11 +176,15 @@ LedStateType BoardAdapter::GetFaultLedState()
 
 void BoardAdapter::SetActiveLedState(LedStateType state)
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     mDriver.SetFruActiveLedState(state);
 }
 
 LedStateType BoardAdapter::GetActiveLedState()
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     if (mIsLedLampTestOn == true)
     {
         mActiveLedState = CYCLING;
@@ -185,16 +203,71 @@ LedStateType BoardAdapter::GetActiveLedState()
 
 void BoardAdapter::DoLedLocationTest(bool doTest)
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     mDriver.LedLocationTest(doTest);
 }
 
 void BoardAdapter::SetPortLedState(QSFPPortId portId, QSFPLedType ledType, LedStateType ledState)
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     mDriver.SetMezzQsfpLedState(portId, ledType, ledState);
 }
 
 port_led_ptr_vec& BoardAdapter::GetPortLedStates()
 {
+    UpdateMezzLedStates();
+
+    return mvPortLedStates;
+}
+
+void BoardAdapter::SetLineLedState(LineId lineId, LineLedType ledType, LedStateType ledState)
+{
+    RegCallerScope callerScope(REG_CALLER_LED);
+
+    mDriver.SetMezzLineLedState(lineId, ledType, ledState);
+}
+
+int BoardAdapter::SetMezzLedStates(const MezzLedStates& ledStates)
+{
+    RegCallerScope callerScope(REG_CALLER_LED);
+
+    return mDriver.SetMezzLedStates(ledStates);
+}
+
+line_led_ptr_vec& BoardAdapter::GetLineLedStates()
+{
+    UpdateMezzLedStates();
+
+    return mvLineLedStates;
+}
+
+void BoardAdapter::GetMezzLedStates(port_led_ptr_vec*& pPortLedStates, line_led_ptr_vec*& pLineLedStates)
+{
+    UpdateMezzLedStates();
+
+    pPortLedStates = &mvPortLedStates;
+    pLineLedStates = &mvLineLedStates;
+}
+
+/*
+ * Refreshes the port and line LED vectors from one driver pass. States
+ * are left as they were if the LED registers cannot be read.
+ */
+void BoardAdapter::UpdateMezzLedStates()
+{
+    RegCallerScope callerScope(REG_CALLER_LED);
+
+    MezzLedStates ledStates;
+
+    bool isRead = false;
+
+    if ((mIsLedLampTestOn == false) && (mIsLedLocTestOn == false))
+    {
+        isRead = (mDriver.GetMezzLedStates(ledStates) == 0);
+    }
+
     for (port_led_vec_itr itr = mvPortLedStates.begin(); itr != mvPortLedStates.end(); itr++)
     {
         if (mIsLedLampTestOn == true)
@@ -207,29 +280,15 @@ port_led_ptr_vec& BoardAdapter::GetPortLedStates()
             (*itr).mActiveLedState = CYCLING_WITH_OFF;
             (*itr).mLosLedState = CYCLING_WITH_OFF;
         }
-        else
+        else if (isRead == true)
         {
             QSFPPortId portId = (*itr).mPortId;
 
-            LedStateType state;
-            mDriver.GetMezzQsfpLedState(portId, QSFP_ACTIVE, state);
-            (*itr).mActiveLedState = state;
-
-            mDriver.GetMezzQsfpLedState(portId, QSFP_LOS, state);
-            (*itr).mLosLedState = state;
+            (*itr).mActiveLedState = ledStates.maQsfpLedStates[QSFP_ACTIVE][portId];
+            (*itr).mLosLedState = ledStates.maQsfpLedStates[QSFP_LOS][portId];
         }
     }
 
-    return mvPortLedStates;
-}
-
-void BoardAdapter::SetLineLedState(LineId lineId, LineLedType ledType, LedStateType ledState)
-{
-    mDriver.SetMezzLineLedState(lineId, ledType, ledState);
-}
-
-line_led_ptr_vec& BoardAdapter::GetLineLedStates()
-{
     for (line_led_vec_itr itr = mvLineLedStates.begin(); itr != mvLineLedStates.end(); itr++)
     {
         if (mIsLedLampTestOn == true)
@@ -242,45 +301,111 @@ line_led_ptr_vec& BoardAdapter::GetLineLedStates()
             (*itr).mActiveLedState = CYCLING_WITH_OFF;
             (*itr).mLosLedState = CYCLING_WITH_OFF;
         }
-        else
+        else if (isRead == true)
         {
             LineId lineId = (*itr).mLineId;
 
-            LedStateType state;
-            mDriver.GetMezzLineLedState(lineId, LINE_ACTIVE, state);
-            (*itr).mActiveLedState = state;
-
-            mDriver.GetMezzLineLedState(lineId, LINE_LOS, state);
-            (*itr).mLosLedState = state;
+            (*itr).mActiveLedState = ledStates.maLineLedStates[LINE_ACTIVE][lineId];
+            (*itr).mLosLedState = ledStates.maLineLedStates[LINE_LOS][lineId];
         }
     }
-
-    return mvLineLedStates;
 }
 
 void BoardAdapter::CheckLedLampLocTestState()
 {
+    RegCallerScope callerScope(REG_CALLER_LED);
+
     mDriver.CheckLedLampLocTestState(mIsLedLampTestOn, mIsLedLocTestOn);
 }
 
 void BoardAdapter::CheckFaults()
 {
+    RegCallerScope callerScope(REG_CALLER_FAULT_POLL);
+
+    // Read FPGA misc status once; all host digital faults use this snapshot
+    DigitalInputSnapshot snapshot;
+    mDriver.GetBrdCmnDriver()->GetDigitalInputSnapshot(MEZZ_BRD_SPEC_NONE, snapshot);
+
+    // Access probes run on bus workers; bounded wait, never blocks the cycle
+    mAccessProbeEngine.RunCycle();
+
     for (auto &it : mvBoardFaults)
     {
-        it.CheckFaultCondition();
+        it.CheckFaultCondition(snapshot);
+    }
+}
+
+void BoardAdapter::CheckFaults(uint32 eventGroups)
+{
+    RegCallerScope callerScope(REG_CALLER_FAULT_POLL);
+
+    if (eventGroups == cFaultEvtGrpAll)
+    {
+        CheckFaults();
+        return;
+    }
+
+    DigitalInputSnapshot snapshot;
+
+    if (eventGroups & (cFaultEvtGrpHostDigital | cFaultEvtGrpPolled))
+    {
+        mDriver.GetBrdCmnDriver()->GetDigitalInputSnapshot(MEZZ_BRD_SPEC_NONE, snapshot);
+    }
+
+    // Polled faults have no event; the collector ticks them
+    if (eventGroups & cFaultEvtGrpPolled)
+    {
+        mAccessProbeEngine.RunCycle();
+
+        for (auto faultId : mvPolledFaultIds)
+        {
+            mvBoardFaults[faultId].CheckFaultCondition(snapshot);
+        }
+    }
+
+    if (eventGroups & cFaultEvtGrpHostDigital)
+    {
+        for (auto faultId : mvHostDigitalFaultIds)
+        {
+            mvBoardFaults[faultId].CheckFaultCondition(snapshot);
+        }
+    }
+
+    if (eventGroups & cFaultEvtGrpTmpAlert)
+    {
+        for (auto faultId : mvTmpAlertFaultIds)
+        {
+            mvBoardFaults[faultId].CheckFaultCondition();
+        }
     }
 }
 
 board_pm_ptr_vec& BoardAdapter::GetBoardPm()
 {
+    RegCallerScope callerScope(REG_CALLER_PM);
+
     for (board_pm_vec_itr itr = mvBoardPms.begin(); itr != mvBoardPms.end(); itr++)
     {
-        (*itr).mValue = mDriver.GetPm((*itr).mId);
+        (*itr).mIsValid = mDriver.GetPm((*itr).mId, (*itr).mValue);
     }
 
     return mvBoardPms;
 }
 
+void BoardAdapter::DumpStatus(std::ostream &os, std::string cmd)
+{
+    BoardCommonAdapter::DumpStatus(os, cmd);
+
+    if (cmd == std::string("probe"))
+    {
+        mAccessProbeEngine.Dump(os);
+    }
+    else if (cmd == std::string("fault_event"))
+    {
+        os << "Fault interrupts: " << mNumFaultIrqs << std::endl;
+    }
+}
+
 void BoardAdapter::DumpEqptInventory( std::ostream &os )
 {
     os << "<<<<<<<<<<<<<<<<<<< BoardAdapter.DumEqptInventory >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
@@ -295,12 +420,16 @@ void BoardAdapter::DumpEqptInventory( std::ostream &os )
 
 void BoardAdapter::Initialize()
 {
+    RegCallerScope callerScope(REG_CALLER_INIT);
+
     INFN_LOG(SeverityLevel::info) << "BoardAdapter::Initialize() is called !!!";
 
     InitUpgradeableDevices();
 
     InitializeFaults();
 
+    InitializeFaultIrq();
+
     // Init pm cache
     for (uint32 i = 0; i < MAX_PM_ID_NUM; ++i)
     {
@@ -373,9 +502,42 @@ void BoardAdapter::InitializeFaults()
                 mDriver.GetBrdCmnDriver(),
                 false,
                 FAULT_UNKNOWN));
+
+        mvHostDigitalFaultIds.push_back(faultId);
     }
 
 
+    INFN_LOG(SeverityLevel::info) << "Initializing TMP112 Alert Faults";
+
+    // Outlet alert is BOARD_TEMP_OORH via FPGA status; mezz alerts are sampled
+    mvBoardFaults.replace(
+        TMZ_TMP_OORH,
+        new boardMs::BoardFaultTmpAlert(
+            TMZ_TMP_OORH,
+            mDriver.GetTmp112Sampler(),
+            TMP112_TOP_MEZZ,
+            false,
+            FAULT_UNKNOWN));
+
+    mvTmpAlertFaultIds.push_back(TMZ_TMP_OORH);
+
+    mvBoardFaults.replace(
+        BMZ_TMP_OORH,
+        new boardMs::BoardFaultTmpAlert(
+            BMZ_TMP_OORH,
+            mDriver.GetTmp112Sampler(),
+            TMP112_BOTTOM_MEZZ,
+            false,
+            FAULT_UNKNOWN));
+
+    mvTmpAlertFaultIds.push_back(BMZ_TMP_OORH);
+
+    if (mDriver.EnableTmpAlertMode(boost::bind(
+            &BoardAdapter::PostFaultEvent, this, cFaultEvtGrpTmpAlert)))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to enable TMP112 alert mode";
+    }
+
     DLOG << "Initializing Host Board ACCESS Faults";
     
     // Get singleton instsance of RT_AccessFaultsMap.
@@ -390,6 +552,7 @@ void BoardAdapter::InitializeFaults()
 
         auto baf = new boardMs::BoardAccessFault(afval);
         mvBoardFaults.replace(afval.boardFaultId, baf);
+        mAccessProbeEngine.AddProbe(baf);
     }
 
     DLOG << "Host Board ACCESS Faults initialized...";
@@ -405,6 +568,7 @@ void BoardAdapter::InitializeFaults()
 
         auto baf = new boardMs::BoardAccessFault(afval);
         mvBoardFaults.replace(afval.boardFaultId, baf);
+        mAccessProbeEngine.AddProbe(baf);
     }
 
     // Iterate Mezzanine Access Faults TOP.
@@ -416,11 +580,73 @@ void BoardAdapter::InitializeFaults()
 
         auto baf = new boardMs::BoardAccessFault(afval);
         mvBoardFaults.replace(afval.boardFaultId, baf);
+        mAccessProbeEngine.AddProbe(baf);
     }
 
     DLOG << "Mezzanine Board ACCESS Faults initialized...";
+
+    std::vector<bool> vIsEventFault(mvBoardFaults.size(), false);
+
+    for (auto faultId : mvHostDigitalFaultIds)
+    {
+        vIsEventFault[faultId] = true;
+    }
+
+    for (auto faultId : mvTmpAlertFaultIds)
+    {
+        vIsEventFault[faultId] = true;
+    }
+
+    for (uint32 i = 0; i < mvBoardFaults.size(); i++)
+    {
+        if (!vIsEventFault[i])
+        {
+            mvPolledFaultIds.push_back(static_cast<BoardFaultId>(i));
+        }
+    }
+
+    mAccessProbeEngine.Start();
 }
 // END BoardAdapter::InitializeFaults()
 
+void BoardAdapter::InitializeFaultIrq()
+{
+    if (mDriver.GetBrdCmnDriver()->OpenFaultIrq() != 0)
+    {
+        INFN_LOG(SeverityLevel::info) << "No fault interrupt. Faults are polled";
+        return;
+    }
+
+    mIsFaultEventCapable = true;
+
+    mThrFaultIrq = boost::thread(boost::bind(
+            &BoardAdapter::FaultIrqWorker, this
+            ));
+}
+
+void BoardAdapter::FaultIrqWorker()
+{
+    INFN_LOG(SeverityLevel::info) << "Fault interrupt worker started";
+
+    while (!mThrFaultIrqExit)
+    {
+        int ret = mDriver.GetBrdCmnDriver()->WaitFaultIrq(cFaultIrqWaitTimeout);
+
+        if (ret > 0)
+        {
+            mNumFaultIrqs++;
+
+            PostFaultEvent(cFaultEvtGrpHostDigital);
+        }
+        else if (ret < 0)
+        {
+            // Safety net poll still covers the faults; avoid spinning
+            boost::this_thread::sleep(boost::posix_time::milliseconds(cFaultIrqErrDelay));
+        }
+    }
+
+    INFN_LOG(SeverityLevel::info) << "Fault interrupt worker finished";
+}
+
 } // END namespace boardAda
 
@@ -11,6 +11,9 @@
 #include <iostream>
 #include <string>
 #include <mutex>
+#include <vector>
+#include <atomic>
+#include <boost/thread.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 
 #include "board_defs.h"
@@ -21,6 +24,7 @@
 
 #include "board_adapter_if.h"
 #include "board_common_adapter.h"
+#include "board_access_probe.h"
 
 namespace boardAda
 {
@@ -85,25 +89,57 @@ public:
 
     line_led_ptr_vec& GetLineLedStates();
 
+    int SetMezzLedStates(const MezzLedStates& ledStates);
+
+    void GetMezzLedStates(port_led_ptr_vec*& pPortLedStates, line_led_ptr_vec*& pLineLedStates);
+
     void CheckLedLampLocTestState();
 
     virtual void CheckFaults();
 
+    virtual void CheckFaults(uint32 eventGroups);
+
 
     board_pm_ptr_vec& GetBoardPm();
 
 
     void DumpEqptInventory( std::ostream &os );
 
+    virtual void DumpStatus(std::ostream &os, std::string cmd);
+
 private:
 
     void Initialize();
 
     void InitializeFaults();
 
+    void InitializeFaultIrq();
+
+    void FaultIrqWorker();
+
+    void UpdateMezzLedStates();
+
     BoardDriver&    mDriver;
 
     std::recursive_mutex mRMutexEqptInv;
+
+    // Runtime access faults, probed by per bus workers
+    AccessProbeEngine mAccessProbeEngine;
+
+    // Faults driven by FPGA misc status, checked on fault interrupt
+    std::vector<BoardFaultId> mvHostDigitalFaultIds;
+
+    // Faults driven by TMP112 comparator state, checked on alert change
+    std::vector<BoardFaultId> mvTmpAlertFaultIds;
+
+    // Faults with no event source, checked on the poll tick
+    std::vector<BoardFaultId> mvPolledFaultIds;
+
+    boost::thread mThrFaultIrq;
+
+    uint64 mNumFaultIrqs;
+
+    std::atomic<bool> mThrFaultIrqExit;
 };
 
 } // namespace boardAda
@@ -81,6 +81,41 @@ public:
 
     virtual line_led_ptr_vec& GetLineLedStates() = 0;
 
+    // Applies every LED not at LED_STATE_UNKNOWN as one batch
+    virtual int SetMezzLedStates(const boardMs::MezzLedStates& ledStates)
+    {
+        for (uint32 i = 0; i < boardMs::MAX_QSFP_NUM; i++)
+        {
+            for (uint32 type = 0; type < boardMs::MAX_QSFP_LED_TYPE; type++)
+            {
+                if (ledStates.maQsfpLedStates[type][i] != boardMs::LED_STATE_UNKNOWN)
+                {
+                    SetPortLedState(boardMs::QSFPPortId(i), boardMs::QSFPLedType(type), ledStates.maQsfpLedStates[type][i]);
+                }
+            }
+        }
+
+        for (uint32 i = 0; i < boardMs::MAX_LINE_NUM; i++)
+        {
+            for (uint32 type = 0; type < boardMs::MAX_LINE_LED_TYPE; type++)
+            {
+                if (ledStates.maLineLedStates[type][i] != boardMs::LED_STATE_UNKNOWN)
+                {
+                    SetLineLedState(boardMs::LineId(i), boardMs::LineLedType(type), ledStates.maLineLedStates[type][i]);
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    // Port and line LED states from one register pass
+    virtual void GetMezzLedStates(port_led_ptr_vec*& pPortLedStates, line_led_ptr_vec*& pLineLedStates)
+    {
+        pPortLedStates = &GetPortLedStates();
+        pLineLedStates = &GetLineLedStates();
+    }
+
     virtual void CheckLedLampLocTestState() {}
 
     // Run diagnostic tests
@@ -98,6 +133,19 @@ public:
 
     virtual void CheckFaults() {}
 
+    // Check only the fault groups named by a fault event
+    virtual void CheckFaults(uint32 eventGroups) { CheckFaults(); }
+
+    /*
+     * Fault events
+     */
+    virtual bool IsFaultEventCapable() { return false; }
+
+    virtual void PostFaultEvent(uint32 eventGroups) {}
+
+    // Returns false on timeout
+    virtual bool WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups) { return false; }
+
     /*
      * Board PM
      */
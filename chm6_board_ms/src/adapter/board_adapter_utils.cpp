@@ -33,12 +33,16 @@ void upgradableDevice::Dump(std::ostream &os)
 const char* BoardPmIdToStr[] =
 {
         "temperature",
+        "inlet_temperature",
+        "top_mezz_temperature",
+        "bottom_mezz_temperature",
 };
 
 Chm6BoardPm::Chm6BoardPm(BoardPmId id, float32 value)
     : mId(id)
     , mName(BoardPmIdToStr[id])
-    , mValue(value) {}
+    , mValue(value)
+    , mIsValid(true) {}
 
 std::string Chm6BoardPm::BoardPmIdToName(BoardPmId id)
 {
@@ -58,6 +62,12 @@ std::string Chm6BoardPm::BoardPmIdToDescrption(BoardPmId id)
     {
         case OUTLET_TEMPERATURE:
             return std::string("Outlet Temperature");
+        case INLET_TEMPERATURE:
+            return std::string("Inlet Temperature");
+        case TOP_MEZZ_TEMPERATURE:
+            return std::string("Top Mezz Temperature");
+        case BOTTOM_MEZZ_TEMPERATURE:
+            return std::string("Bottom Mezz Temperature");
         default:
             return std::string("Not specified");
     }
@@ -65,7 +75,7 @@ std::string Chm6BoardPm::BoardPmIdToDescrption(BoardPmId id)
 
 void Chm6BoardPm::Dump(std::ostream &os)
 {
-    os << boost::format("%-3d : %-20s : %f") % (int)mId % mName % mValue << std::endl;
+    os << boost::format("%-3d : %-20s : %f%s") % (int)mId % mName % mValue % (mIsValid ? "" : " (invalid)") << std::endl;
 }
 
 }
@@ -4,6 +4,8 @@
  *  Created on: 9/1, 2020
  */
 
+#include <chrono>
+
 #include "board_common_adapter.h"
 #include "InfnLogger.h"
 #include "board_fault_defs.h"
@@ -30,6 +32,10 @@ BoardCommonAdapter::BoardCommonAdapter()
     , mIsLedLampTestOn(false)
     , mIsLedLocTestOn(false)
     , mpLog(new SimpleLog::Log(2000))
+    , mPendingFaultEvtGrps(0)
+    , mNumFaultEvtPosted(0)
+    , mNumFaultEvtDelivered(0)
+    , mIsFaultEventCapable(false)
 {
     std::ostringstream  log;
     log << " Created!";
@@ -66,6 +72,55 @@ board_pm_ptr_vec& BoardCommonAdapter::GetBoardPm()
     return mvBoardPms;
 }
 
+/*
+ * Fault events
+ */
+void BoardCommonAdapter::PostFaultEvent(uint32 eventGroups)
+{
+    {
+        std::lock_guard<std::mutex> guard(mFaultEvtLock);
+
+        mPendingFaultEvtGrps |= eventGroups;
+        mNumFaultEvtPosted++;
+    }
+
+    BRD_TRACE(mTrace, "Post fault event groups: 0x%x", eventGroups);
+
+    mFaultEvtCond.notify_one();
+}
+
+bool BoardCommonAdapter::WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups)
+{
+    std::unique_lock<std::mutex> lock(mFaultEvtLock);
+
+    if (!mFaultEvtCond.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                                [&]{ return (mPendingFaultEvtGrps != 0); }))
+    {
+        return false;
+    }
+
+    // Events posted while busy are merged into one
+    eventGroups = mPendingFaultEvtGrps;
+    mPendingFaultEvtGrps = 0;
+    mNumFaultEvtDelivered++;
+
+    BRD_TRACE(mTrace, "Deliver fault event groups: 0x%x", eventGroups);
+
+    return true;
+}
+
+void BoardCommonAdapter::DumpFaultEvents(std::ostream &os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardAdapter.DumpFaultEvents >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
+
+    std::lock_guard<std::mutex> guard(mFaultEvtLock);
+
+    os << "Event capable  : " << std::boolalpha << mIsFaultEventCapable << std::noboolalpha << endl;
+    os << "Events posted  : " << mNumFaultEvtPosted << endl;
+    os << "Events handled : " << mNumFaultEvtDelivered << endl;
+    os << "Pending groups : 0x" << std::hex << mPendingFaultEvtGrps << std::dec << endl;
+}
+
 void BoardCommonAdapter::DumpLog(std::ostream &os)
 {
     os << "<<<<<<<<<<<<<<<<<<< BoardAdapter.DumpLog >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
@@ -80,11 +135,20 @@ void BoardCommonAdapter::DumpLog(std::ostream &os)
     {
         os << "BoardAdapter Log is not created!" << std::endl;
     }
+
+    os << std::endl << "BoardAdapter Trace:" << std::endl;
+
+    mTrace.Dump(os);
 }
 
 void BoardCommonAdapter::DumpStatus(std::ostream &os, std::string cmd)
 {
     os << "BoardAdapter::DumpStatus(): cmd = " << cmd << std::endl;
+
+    if (cmd == std::string("fault_event"))
+    {
+        DumpFaultEvents(os);
+    }
 }
 
 void BoardCommonAdapter::ResetLog( std::ostream &os )
@@ -98,6 +162,8 @@ void BoardCommonAdapter::ResetLog( std::ostream &os )
         mpLog->ResetLog();
         os << "BoardAdapter Log has been reset!" << std::endl;
     }
+
+    mTrace.Reset();
 }
 
 void BoardCommonAdapter::DumpUpgradableDevices( std::ostream &os )
@@ -192,6 +258,9 @@ void BoardCommonAdapter::SetFaultSim(std::ostream &os, uint32 faultId, bool isSi
         mvBoardFaults[faultId].SetSimEnable(isSimEn);
     }
 
+    // Publish without waiting for the next poll
+    PostFaultEvent(cFaultEvtGrpAll);
+
     DumpFaults(os, faultId);
 }
 
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <string>
 #include <mutex>
+#include <condition_variable>
 #include <boost/ptr_container/ptr_vector.hpp>
 
 #include "board_defs.h"
@@ -18,6 +19,7 @@
 #include "board_driver.h"
 
 #include "SimpleLog.h"
+#include "board_trace.h"
 
 #include "board_adapter_if.h"
 
@@ -50,6 +52,15 @@ public:
 
     virtual board_pm_ptr_vec& GetBoardPm();
 
+    /*
+     * Fault events
+     */
+    virtual bool IsFaultEventCapable() { return mIsFaultEventCapable; }
+
+    virtual void PostFaultEvent(uint32 eventGroups);
+
+    virtual bool WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups);
+
 
     upgradable_device_ptr_vec& GetUpgradableDevices();
 
@@ -91,6 +102,8 @@ protected:
 
     uint32 LookupFaultId(std::string faultName);
 
+    void DumpFaultEvents(std::ostream &os);
+
     std::string     mAid;
     std::string     mName;
 
@@ -129,6 +142,18 @@ protected:
     SimpleLog::Log*  mpLog;
     mutable std::mutex    mLogLock;
 
+    // Fault event and action paths; see BRD_TRACE
+    BoardTraceRing mTrace;
+
+    // Fault event groups pending for the fault collector
+    std::mutex mFaultEvtLock;
+    std::condition_variable mFaultEvtCond;
+    uint32 mPendingFaultEvtGrps;
+    uint64 mNumFaultEvtPosted;
+    uint64 mNumFaultEvtDelivered;
+
+    bool mIsFaultEventCapable;
+
 private:
   const uint32 StrToFaultId( RT_AccessFaultsMap& afMap,
                              std::string strfaultId );
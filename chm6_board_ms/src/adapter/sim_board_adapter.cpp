@@ -20,6 +20,9 @@ SimBoardAdapter::SimBoardAdapter()
     log << " Created!";
     AddLog(__func__, __LINE__, log.str());
 
+    // Events come from InjectFaultEvent and fault sim
+    mIsFaultEventCapable = true;
+
     Initialize();
 }
 
@@ -214,6 +217,16 @@ void SimBoardAdapter::SetLedLampTest(std::ostream &os, bool doTest)
     os << "SetLedLampTest: " << std::boolalpha << mIsLedLampTestOn << std::noboolalpha << std::endl;
 }
 
+/*
+ * Inject fault event
+ */
+void SimBoardAdapter::InjectFaultEvent(std::ostream &os, uint32 eventGroups)
+{
+    PostFaultEvent(eventGroups & cFaultEvtGrpAll);
+
+    os << "InjectFaultEvent: groups 0x" << std::hex << (eventGroups & cFaultEvtGrpAll) << std::dec << std::endl;
+}
+
 /* ==============================
  * APIs defined in BoardAdapterIf
  * ==============================
@@ -225,9 +238,7 @@ int SimBoardAdapter::SetHostBoardAction(hostBoardActionType action)
 {
     mLastBoardAction = action;
 
-    std::ostringstream  log;
-    log << "mLastBoardAction = " << HostBoardActionTypeToStr(mLastBoardAction);
-    AddLog(__func__, __LINE__, log.str());
+    BRD_TRACE(mTrace, "mLastBoardAction = %d", mLastBoardAction);
 
     return 0;
 }
@@ -79,6 +79,11 @@ public:
      */
     void SetLedLampTest(std::ostream &os, bool doTest);
 
+    /*
+     * Inject fault event
+     */
+    void InjectFaultEvent(std::ostream &os, uint32 eventGroups);
+
     /* ================================
      * APIs defined in BoardAdapterIf
      * ================================
@@ -68,6 +68,11 @@ public:
      * Set LED lamp test
      */
     virtual void SetLedLampTest(std::ostream &os, bool doTest) {}
+
+    /*
+     * Inject fault event, as the fault interrupt does on hardware
+     */
+    virtual void InjectFaultEvent(std::ostream &os, uint32 eventGroups) {}
 };
 
 }
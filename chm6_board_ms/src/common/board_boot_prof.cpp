@@ -0,0 +1,398 @@
+/*
+ * board_boot_prof.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <boost/format.hpp>
+
+#include "board_boot_prof.h"
+#include "board_journal.h"
+#include "InfnLogger.h"
+
+const uint32 BoardBootProf::cNumBootRecords;
+const uint32 BoardBootProf::cNumCompareBoots;
+const uint32 BoardBootProf::cRegressPct;
+const uint32 BoardBootProf::cRegressMinMs;
+
+// Next to the journal; BoardBootProfFile env overrides
+const char* cBootProfFile       = "/var/log/chm6_board_boot_prof.bin";
+const char* cBootProfFileEnvStr = "BoardBootProfFile";
+
+const uint32 cBootProfMagic   = 0x42505246; // "BPRF"
+const uint32 cBootProfVersion = 1;
+
+BoardBootProf& BoardBootProf::getInstance()
+{
+    static BoardBootProf theInstance;
+    return theInstance;
+}
+
+BoardBootProf::BoardBootProf()
+{
+    memset(&mCur, 0, sizeof(mCur));
+
+    mCur.mProcStartNs = ProcStartNs();
+}
+
+uint64 BoardBootProf::NowNs()
+{
+    struct timespec mono;
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+
+    return ((uint64)mono.tv_sec * 1000000000ULL + mono.tv_nsec);
+}
+
+/*
+ * Field 22 of /proc/self/stat, clock ticks since kernel boot. Taken as
+ * monotonic time; the card does not suspend.
+ */
+uint64 BoardBootProf::ProcStartNs()
+{
+    std::ifstream statFile("/proc/self/stat");
+    std::string line;
+
+    if (!std::getline(statFile, line))
+    {
+        return NowNs();
+    }
+
+    // comm may hold spaces; fields restart after its closing paren
+    size_t pos = line.rfind(')');
+    if (pos == std::string::npos)
+    {
+        return NowNs();
+    }
+
+    std::istringstream fields(line.substr(pos + 1));
+    std::string field;
+
+    for (uint32 i = 3; i <= 22; i++)
+    {
+        if (!(fields >> field))
+        {
+            return NowNs();
+        }
+    }
+
+    uint64 ticks = strtoull(field.c_str(), NULL, 10);
+    long   hz    = sysconf(_SC_CLK_TCK);
+
+    if (hz <= 0)
+    {
+        return NowNs();
+    }
+
+    return (ticks * (1000000000ULL / hz));
+}
+
+std::string BoardBootProf::GetFileName()
+{
+    const char* pEnvStr = getenv(cBootProfFileEnvStr);
+
+    return std::string(pEnvStr ? pEnvStr : cBootProfFile);
+}
+
+void BoardBootProf::Begin(BootPhaseType phase)
+{
+    if (phase >= NUM_BOOT_PHASES)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mCur.maStartNs[phase] = NowNs();
+    mCur.maEndNs[phase]   = 0;
+}
+
+void BoardBootProf::End(BootPhaseType phase)
+{
+    if (phase >= NUM_BOOT_PHASES)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mCur.maEndNs[phase] = NowNs();
+}
+
+int BoardBootProf::Save(uint32 bootReason)
+{
+    std::vector<BootProfRecord> vRecs;
+
+    Load(vRecs);
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mCur.mSeq        = (vRecs.empty() ? 1 : (vRecs.back().mSeq + 1));
+    mCur.mRealSec    = time(NULL);
+    mCur.mBootReason = bootReason;
+
+    BoardJournal& journal = BoardJournal::getInstance();
+
+    for (uint32 i = 0; i < NUM_BOOT_PHASES; i++)
+    {
+        if (mCur.maEndNs[i] > mCur.maStartNs[i])
+        {
+            journal.Record(JOURNAL_REC_BOOT_PHASE, i, (mCur.maEndNs[i] - mCur.maStartNs[i]) / 1000);
+        }
+    }
+
+    journal.Flush(false);
+
+    std::string fileName = GetFileName();
+
+    int fd = open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to open boot profile " << fileName
+                                       << " errno: " << errno;
+        return -1;
+    }
+
+    int retVal = 0;
+
+    BootProfHeader hdr;
+    hdr.mMagic      = cBootProfMagic;
+    hdr.mVersion    = cBootProfVersion;
+    hdr.mRecordSize = sizeof(BootProfRecord);
+    hdr.mNumRecords = cNumBootRecords;
+
+    // A new or foreign file starts over
+    if (vRecs.empty())
+    {
+        if ((ftruncate(fd, 0) != 0) ||
+            (ftruncate(fd, sizeof(hdr) + cNumBootRecords * sizeof(BootProfRecord)) != 0) ||
+            (pwrite(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr)))
+        {
+            retVal = -1;
+        }
+    }
+
+    off_t offset = sizeof(hdr) + ((mCur.mSeq - 1) % cNumBootRecords) * sizeof(BootProfRecord);
+
+    if ((retVal != 0) ||
+        (pwrite(fd, &mCur, sizeof(mCur), offset) != sizeof(mCur)) ||
+        (fsync(fd) != 0))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to write boot profile " << fileName
+                                       << " errno: " << errno;
+        retVal = -1;
+    }
+
+    close(fd);
+
+    uint64 initNs = mCur.maEndNs[BOOT_PHASE_INIT] - mCur.maStartNs[BOOT_PHASE_INIT];
+
+    INFN_LOG(SeverityLevel::info) << "Boot profile seq " << mCur.mSeq << ": init took "
+                                  << (initNs / 1000000) << " ms, "
+                                  << ((mCur.maEndNs[BOOT_PHASE_INIT] - mCur.mProcStartNs) / 1000000)
+                                  << " ms from process start";
+
+    return retVal;
+}
+
+int BoardBootProf::Load(std::vector<BootProfRecord>& vRecs)
+{
+    vRecs.clear();
+
+    std::string fileName = GetFileName();
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    BootProfHeader hdr;
+
+    if ((pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr)) ||
+        (hdr.mMagic != cBootProfMagic) ||
+        (hdr.mVersion != cBootProfVersion) ||
+        (hdr.mRecordSize != sizeof(BootProfRecord)) ||
+        (hdr.mNumRecords != cNumBootRecords))
+    {
+        close(fd);
+        return -1;
+    }
+
+    for (uint32 i = 0; i < cNumBootRecords; i++)
+    {
+        BootProfRecord rec;
+
+        if (pread(fd, &rec, sizeof(rec), sizeof(hdr) + i * sizeof(rec)) != sizeof(rec))
+        {
+            break;
+        }
+
+        if (rec.mSeq != 0)
+        {
+            vRecs.push_back(rec);
+        }
+    }
+
+    close(fd);
+
+    std::sort(vRecs.begin(), vRecs.end(),
+              [](const BootProfRecord& a, const BootProfRecord& b){ return (a.mSeq < b.mSeq); });
+
+    return 0;
+}
+
+void BoardBootProf::Dump(std::ostream& os, uint32 numCompareBoots,
+                         boost::function<std::string(uint32 bootReason)> reasonToName)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardBootProf.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    std::vector<BootProfRecord> vRecs;
+
+    Load(vRecs);
+
+    os << "File: " << GetFileName() << " Boots: " << vRecs.size() << std::endl << std::endl;
+
+    if (vRecs.empty())
+    {
+        return;
+    }
+
+    auto reasonStr = [&](uint32 reason)
+    {
+        return (reasonToName ? reasonToName(reason) : std::to_string(reason));
+    };
+
+    const BootProfRecord& cur = vRecs.back();
+
+    // Earlier boots of the same kind, newest first
+    std::vector<const BootProfRecord*> vPrev;
+
+    for (auto it = vRecs.rbegin() + 1; (it != vRecs.rend()) && (vPrev.size() < numCompareBoots); it++)
+    {
+        if (it->mBootReason == cur.mBootReason)
+        {
+            vPrev.push_back(&(*it));
+        }
+    }
+
+    os << "Latest boot seq " << cur.mSeq << " " << reasonStr(cur.mBootReason)
+       << ", compared with " << vPrev.size() << " earlier boot(s) of the same reason" << std::endl;
+
+    os << boost::format("%-14s : %10s : %10s : %10s : %10s : %10s : %8s")
+          % "Phase" % "Start(ms)" % "Dur(ms)" % "Avg(ms)" % "Min(ms)" % "Max(ms)" % "Delta"
+       << std::endl;
+
+    for (uint32 i = 0; i < NUM_BOOT_PHASES; i++)
+    {
+        if (cur.maEndNs[i] <= cur.maStartNs[i])
+        {
+            continue;
+        }
+
+        float64 durMs   = (cur.maEndNs[i] - cur.maStartNs[i]) / 1e6;
+        float64 startMs = (cur.maStartNs[i] - cur.mProcStartNs) / 1e6;
+
+        float64 sumMs = 0, minMs = 0, maxMs = 0;
+        uint32  num   = 0;
+
+        for (auto pPrev : vPrev)
+        {
+            if (pPrev->maEndNs[i] <= pPrev->maStartNs[i])
+            {
+                continue;
+            }
+
+            float64 prevMs = (pPrev->maEndNs[i] - pPrev->maStartNs[i]) / 1e6;
+
+            minMs  = (num ? std::min(minMs, prevMs) : prevMs);
+            maxMs  = (num ? std::max(maxMs, prevMs) : prevMs);
+            sumMs += prevMs;
+            num++;
+        }
+
+        if (num == 0)
+        {
+            os << boost::format("%-14s : %10.1f : %10.1f : %10s : %10s : %10s : %8s")
+                  % PhaseToStr(BootPhaseType(i)) % startMs % durMs % "-" % "-" % "-" % "-" << std::endl;
+            continue;
+        }
+
+        float64 avgMs = sumMs / num;
+
+        bool isRegress = ((durMs - avgMs) > cRegressMinMs) &&
+                         ((durMs - avgMs) * 100 > avgMs * cRegressPct);
+
+        os << boost::format("%-14s : %10.1f : %10.1f : %10.1f : %10.1f : %10.1f : %+7.0f%%%s")
+              % PhaseToStr(BootPhaseType(i)) % startMs % durMs % avgMs % minMs % maxMs
+              % (avgMs > 0 ? (durMs - avgMs) * 100 / avgMs : 0.0)
+              % (isRegress ? " << SLOWER" : "") << std::endl;
+    }
+
+    os << std::endl << "History" << std::endl;
+
+    os << boost::format("%6s : %-19s : %-24s : %10s : %14s")
+          % "Seq" % "Time" % "Reason" % "Init(ms)" % "FromStart(ms)" << std::endl;
+
+    for (auto& rec : vRecs)
+    {
+        char timeStr[32];
+        time_t realSec = rec.mRealSec;
+        struct tm tmTime;
+        strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", localtime_r(&realSec, &tmTime));
+
+        os << boost::format("%6d : %-19s : %-24s : %10.1f : %14.1f")
+              % rec.mSeq
+              % timeStr
+              % reasonStr(rec.mBootReason)
+              % ((rec.maEndNs[BOOT_PHASE_INIT] - rec.maStartNs[BOOT_PHASE_INIT]) / 1e6)
+              % ((rec.maEndNs[BOOT_PHASE_INIT] - rec.mProcStartNs) / 1e6) << std::endl;
+    }
+}
+
+std::string BoardBootProf::PhaseToStr(BootPhaseType phase)
+{
+    switch (phase)
+    {
+        case BOOT_PHASE_INIT:
+            return std::string("init");
+        case BOOT_PHASE_NB_CONN:
+            return std::string("nb_conn");
+        case BOOT_PHASE_INIT_HW:
+            return std::string("init_hw");
+        case BOOT_PHASE_COLD_INIT:
+            return std::string("cold_init");
+        case BOOT_PHASE_MEZZ_PWR_OFF:
+            return std::string("mezz_pwr_off");
+        case BOOT_PHASE_LATCH_EN:
+            return std::string("latch_en");
+        case BOOT_PHASE_LED_CTRL:
+            return std::string("led_ctrl");
+        case BOOT_PHASE_MEZZ_PWR_ON:
+            return std::string("mezz_pwr_on");
+        case BOOT_PHASE_RST_RELEASE:
+            return std::string("rst_release");
+        case BOOT_PHASE_LED_READY:
+            return std::string("led_ready");
+        case BOOT_PHASE_FAULT_LED:
+            return std::string("fault_led");
+        case BOOT_PHASE_INIT_MEZZ:
+            return std::string("init_mezz");
+        case BOOT_PHASE_INIT_BCM:
+            return std::string("init_bcm");
+        case BOOT_PHASE_WARM_INIT:
+            return std::string("warm_init");
+        default:
+            return std::string("unknown");
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * board_boot_prof.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_BOOT_PROF_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_BOOT_PROF_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <boost/function.hpp>
+
+#include "types.h"
+
+typedef enum BootPhaseType
+{
+    BOOT_PHASE_INIT = 0,        // BoardInitManager::initialize() up to STATE_COMPLETE
+    BOOT_PHASE_NB_CONN,         // Redis connect, init state read and create
+    BOOT_PHASE_INIT_HW,         // BoardInitManager::initHw()
+    BOOT_PHASE_COLD_INIT,       // BoardInitUtil::ColdInit()
+    BOOT_PHASE_MEZZ_PWR_OFF,    // 1.
+    BOOT_PHASE_LATCH_EN,        // 2.
+    BOOT_PHASE_LED_CTRL,        // 3.
+    BOOT_PHASE_MEZZ_PWR_ON,     // 4.
+    BOOT_PHASE_RST_RELEASE,     // 5.
+    BOOT_PHASE_LED_READY,       // 5.a.
+    BOOT_PHASE_FAULT_LED,       // 5.b.
+    BOOT_PHASE_INIT_MEZZ,       // 6.
+    BOOT_PHASE_INIT_BCM,
+    BOOT_PHASE_WARM_INIT,       // BoardInitUtil::WarmInit()
+    NUM_BOOT_PHASES
+} BootPhaseType;
+
+// One boot; fixed width so the history file is a plain ring
+struct BootProfRecord
+{
+    uint64 mSeq;                           // 0 if never written
+    uint32 mRealSec;                       // CLOCK_REALTIME at save
+    uint32 mBootReason;
+    uint64 mProcStartNs;                   // CLOCK_MONOTONIC at process start
+    uint64 maStartNs[NUM_BOOT_PHASES];     // CLOCK_MONOTONIC, 0 if the phase did not run
+    uint64 maEndNs[NUM_BOOT_PHASES];
+};
+
+/*
+ * Boot phase timing for board init. Phases are stamped with the
+ * monotonic clock as init runs; Save() appends the boot to a small
+ * history file next to the journal and journals each phase duration.
+ * Dump() runs in board ms, reads the history back and compares the
+ * latest boot against earlier boots with the same boot reason.
+ */
+class BoardBootProf
+{
+public:
+
+    static BoardBootProf& getInstance();
+
+    void Begin(BootPhaseType phase);
+
+    void End(BootPhaseType phase);
+
+    int Save(uint32 bootReason);
+
+    void Dump(std::ostream& os, uint32 numCompareBoots,
+              boost::function<std::string(uint32 bootReason)> reasonToName = 0);
+
+    static std::string PhaseToStr(BootPhaseType phase);
+
+    static const uint32 cNumBootRecords  = 32;
+    static const uint32 cNumCompareBoots = 8;
+
+    // A phase is flagged when slower than the average by both margins
+    static const uint32 cRegressPct      = 20;
+    static const uint32 cRegressMinMs    = 20;
+
+private:
+
+    struct BootProfHeader
+    {
+        uint32 mMagic;
+        uint32 mVersion;
+        uint32 mRecordSize;
+        uint32 mNumRecords;
+    };
+
+    BoardBootProf();
+
+    ~BoardBootProf() {}
+
+    static uint64 NowNs();
+
+    static uint64 ProcStartNs();
+
+    static std::string GetFileName();
+
+    // All valid records, oldest first
+    int Load(std::vector<BootProfRecord>& vRecs);
+
+    BootProfRecord mCur;
+
+    std::mutex mLock;
+};
+
+// Stamps phase for the scope
+class BootPhaseScope
+{
+public:
+
+    explicit BootPhaseScope(BootPhaseType phase)
+        : mPhase(phase)
+    {
+        BoardBootProf::getInstance().Begin(mPhase);
+    }
+
+    ~BootPhaseScope()
+    {
+        BoardBootProf::getInstance().End(mPhase);
+    }
+
+    BootPhaseScope(const BootPhaseScope&) = delete;
+
+    BootPhaseScope& operator=(const BootPhaseScope&) = delete;
+
+private:
+
+    BootPhaseType mPhase;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_BOOT_PROF_H_ */
@@ -208,22 +208,25 @@ struct Chm6EqptInventory
 typedef enum BoardPmId
 {
     OUTLET_TEMPERATURE = 0,
+    INLET_TEMPERATURE,
+    TOP_MEZZ_TEMPERATURE,
+    BOTTOM_MEZZ_TEMPERATURE,
     MAX_PM_ID_NUM
 }BoardPmId;
 
 struct Chm6BoardPm
 {
-    Chm6BoardPm() {}
+    Chm6BoardPm() : mIsValid(true) {}
     ~Chm6BoardPm(){}
 
     Chm6BoardPm(BoardPmId id, float32 value);
 
     Chm6BoardPm(std::string name, float32 value)
-     : mName(name), mValue(value)
+     : mName(name), mValue(value), mIsValid(true)
     {}
 
     Chm6BoardPm(const char* name, float32 value)
-     : mName(name), mValue(value)
+     : mName(name), mValue(value), mIsValid(true)
     {}
 
     void SetName(std::string& name)
@@ -250,6 +253,9 @@ struct Chm6BoardPm
     BoardPmId   mId;
     std::string mName;
     float32     mValue;
+
+    // False when the last sample could not be taken; mValue is then not current
+    bool        mIsValid;
 };
 
 typedef boost::ptr_vector<boardMs::upgradableDevice>  upgradable_device_ptr_vec;
@@ -346,7 +352,7 @@ const uint32 cFpgaImbusReg_IMBUS_LED_SYNC_mask = (0x1 << 1);
  * const uint32 cFpgaLedReg3_2    = 0x7c; // Top Mezzanine card
  *
  * 10:8 RW FRU_ACTIVE 0x0
- * Y/G � Active LED
+ * Y/G  Active LED
  */
 const uint32 cFpgaLedReg3_FRU_ACTIVE_LED_Addr = cFpgaLedReg3_1;
 
@@ -692,7 +698,7 @@ static std::string LineIdToStr(LineId id)
 }
 
 /* LINE LEDs
- * 4 Line LEDs (2 LEDs per Line): RED � LOS, Y/G � Active LED
+ * 4 Line LEDs (2 LEDs per Line): RED  LOS, Y/G  Active LED
  *
  * 4.2.22 Register: 0x6C[2,0x10] LED_REG3
  * const uint32 cFpgaLedReg3_1    = 0x6c; // Bottom Mezzanine card
@@ -822,6 +828,33 @@ struct Chm6LineLedStates
 typedef boost::ptr_vector<boardMs::Chm6LineLedStates>  line_led_ptr_vec;
 typedef line_led_ptr_vec::iterator line_led_vec_itr;
 
+// All mezz LED states, read in or applied as one register pass
+struct MezzLedStates
+{
+    MezzLedStates()
+    {
+        for (auto& states : maQsfpLedStates)
+        {
+            for (auto& state : states)
+            {
+                state = LED_STATE_UNKNOWN;
+            }
+        }
+
+        for (auto& states : maLineLedStates)
+        {
+            for (auto& state : states)
+            {
+                state = LED_STATE_UNKNOWN;
+            }
+        }
+    }
+
+    LedStateType maQsfpLedStates[MAX_QSFP_LED_TYPE][MAX_QSFP_NUM];
+
+    LedStateType maLineLedStates[MAX_LINE_LED_TYPE][MAX_LINE_NUM];
+};
+
 
 /*
 * FPGA Misc Status and FGPA IOExp Defs
@@ -896,12 +929,67 @@ typedef enum mezzBoardSpecType
     MEZZ_BRD_SPEC_NONE
 }mezzBoardSpecType;
 
+/*
+ * Digital fault inputs captured once per fault cycle:
+ * FPGA misc status word and the 3 input ports of each mezz IO expander.
+ * All digital input faults of one cycle are evaluated against these words.
+ */
+struct DigitalInputSnapshot
+{
+    DigitalInputSnapshot()
+    : mFpgaMiscStatus(0)
+    , mIsFpgaMiscStatusValid(false)
+    {
+        for (uint32 i = 0; i < NUM_MEZZ_BRD_TYPES; ++i)
+        {
+            mMezzIoExpInput[i] = 0;
+            mIsMezzIoExpInputValid[i] = false;
+        }
+    }
+
+    uint32 mFpgaMiscStatus;
+    bool   mIsFpgaMiscStatusValid;
+
+    uint32 mMezzIoExpInput[NUM_MEZZ_BRD_TYPES];
+    bool   mIsMezzIoExpInputValid[NUM_MEZZ_BRD_TYPES];
+};
+
+/*
+ * Fault groups carried by a fault event.
+ * Host digital faults follow the FPGA misc status interrupt; TMP112
+ * alerts follow the comparator state seen by the temperature sampler;
+ * the rest have no event and are only evaluated by the safety net poll.
+ */
+const uint32 cFaultEvtGrpHostDigital = 1 << 0;
+const uint32 cFaultEvtGrpPolled      = 1 << 1;
+const uint32 cFaultEvtGrpTmpAlert    = 1 << 2;
+const uint32 cFaultEvtGrpAll         = (cFaultEvtGrpHostDigital | cFaultEvtGrpPolled | cFaultEvtGrpTmpAlert);
+
 const uint16 cAdm1066EepromRevAddr = 0xF900;
 
 const uint32 cOutLetTmpLLim = 72;
 const uint32 cOutLetTmpHLim = 75; // C
 
 const uint32 cColdRestartDcoDelaySec = 180;
+
+const uint32 cLedShadowVerifyPeriodSec = 30;
+
+// Cached TMP112 sample older than this is not published
+const uint32 cTmp112MaxSampleAgeMs = 5000;
+
+// CAV24C02 MFG EEPROM programming; write cycle is 5 ms max per the data sheet
+const uint32 cMfgEepromPageSize        = 16;
+const uint32 cMfgEepromWriteCycleMaxMs = 10;
+const uint32 cMfgEepromAckPollUs       = 500;
+
+// MFG EEPROM change probe: leading header bytes (format version, TLV area
+// length) and the stored TLV area CRC-32 just before the TLV area end
+const uint32 cMfgEepromProbeHdrLen    = 8;
+const uint32 cMfgEepromProbeTlvCrcLen = 4;
+
+// Warm init fingerprint reads; a read that keeps failing is not a change
+const uint32 cInitFprintReadTries   = 3;
+const uint32 cInitFprintReadRetryMs = 100;
 } // namespace boardMs
 
 #endif /* CHM6_BOARD_MS_SRC_BOARDDEFS_H_ */
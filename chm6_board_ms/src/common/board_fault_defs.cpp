@@ -295,8 +295,11 @@ void Chm6BoardFault::CheckFaultCondition()
     }
 
     DLOG << "Checking fault: " << static_cast<uint32>(mId);
-    faultConditionType newCondition = CheckFault();
+    UpdateCondition(CheckFault());
+}
 
+void Chm6BoardFault::UpdateCondition(faultConditionType newCondition)
+{
     if ((mCondition != newCondition)
         && (newCondition != FAULT_UNKNOWN))
     {
@@ -398,6 +401,24 @@ faultConditionType BoardFaultFpga::CheckFault()
     return GetFaultState();
 }
 
+// Check against the cycle snapshot instead of reading the register again
+void BoardFaultFpga::CheckFaultCondition(const DigitalInputSnapshot& snapshot)
+{
+    if (mSimEn)
+    {
+        return;
+    }
+
+    uint32 regVal;
+    if (GetSnapshotValue(snapshot, regVal))
+    {
+        // Read failure already logged by driver; keep last condition
+        return;
+    }
+
+    UpdateCondition(EvalFaultState(regVal));
+}
+
 faultConditionType BoardFaultFpga::GetFaultState()
 {
     uint32 regVal;
@@ -412,6 +433,11 @@ faultConditionType BoardFaultFpga::GetFaultState()
         return FAULT_UNKNOWN;
     }
 
+    return EvalFaultState(regVal);
+}
+
+faultConditionType BoardFaultFpga::EvalFaultState(uint32 regVal)
+{
     INFN_LOG(SeverityLevel::debug) << "Fault Id: "
                     << static_cast<uint32>(mId)
                     << " Reg Value: 0x"
@@ -445,6 +471,17 @@ int BoardFaultFpga::GetRegValue(const uint32 &regVal)
                const_cast<uint32&>(regVal));
 }
 
+int BoardFaultFpga::GetSnapshotValue(const DigitalInputSnapshot& snapshot, uint32 &regVal)
+{
+    if (!snapshot.mIsFpgaMiscStatusValid)
+    {
+        return -1;
+    }
+
+    regVal = snapshot.mFpgaMiscStatus;
+    return 0;
+}
+
 BoardFaultMezzIoExp::BoardFaultMezzIoExp(
     const DigitalInputFaultData& inputFltData,
     std::shared_ptr<BoardCommonDriver> brdDriver,
@@ -462,6 +499,40 @@ int BoardFaultMezzIoExp::GetRegValue(const uint32 &regVal)
               mMezzBrdId, const_cast<uint32&>(regVal));
 }
 
+int BoardFaultMezzIoExp::GetSnapshotValue(const DigitalInputSnapshot& snapshot, uint32 &regVal)
+{
+    if (!snapshot.mIsMezzIoExpInputValid[mMezzBrdId])
+    {
+        return -1;
+    }
+
+    regVal = snapshot.mMezzIoExpInput[mMezzBrdId];
+    return 0;
+}
+
+BoardFaultTmpAlert::BoardFaultTmpAlert(BoardFaultId id,
+                                       Tmp112Sampler* pSampler,
+                                       Tmp112SensorType sensorType,
+                                       bool isSimEn,
+                                       faultConditionType condition)
+    : Chm6BoardFault(id, isSimEn, condition)
+    , mpSampler(pSampler)
+    , mSensorType(sensorType)
+{
+}
+
+faultConditionType BoardFaultTmpAlert::CheckFault()
+{
+    Tmp112Reading reading;
+
+    if (!mpSampler->GetReading(mSensorType, reading) || !reading.mIsValid)
+    {
+        return FAULT_UNKNOWN;
+    }
+
+    return (reading.mIsAlert ? FAULT_SET : FAULT_CLEAR);
+}
+
 
 // Implementation of C++11 "Meyers Singleton"
 // Automatically thread-safe in C++11.
@@ -817,16 +888,48 @@ void RT_AccessFaultsMap::SIM_InitBoardMezAccessFaultsMap_t()
 
 
 
+static RegBusType AccessFaultBus(BoardFaultId faultId)
+{
+    switch (faultId)
+    {
+        case HOST_PWR_SEQ_ACCESS_FAIL:
+        case HOST_HS_ACCESS_FAIL:
+            return REG_BUS_PS_I2C0;
+        case BMZ_PWR_SEQ_ACCESS_FAIL:
+        case BMZ_TMP_I2C_FAIL:
+            return REG_BUS_PL_I2C0;
+        case TMZ_PWR_SEQ_ACCESS_FAIL:
+        case TMZ_TMP_I2C_FAIL:
+            return REG_BUS_PL_I2C1;
+        case BMZ_I2C_CLKGEN_I2C_FAIL:
+        case BMZ_IOEXP_ACCESS_FAIL:
+        case BMZ_FPC1_ACCESS_FAIL:
+        case BMZ_FPC2_ACCESS_FAIL:
+            return REG_BUS_PL_I2C2;
+        case TMZ_I2C_CLKGEN_I2C_FAIL:
+        case TMZ_IOEXP_ACCESS_FAIL:
+        case TMZ_FPC1_ACCESS_FAIL:
+        case TMZ_FPC2_ACCESS_FAIL:
+            return REG_BUS_PL_I2C3;
+        default:
+            return REG_BUS_PL_I2C4;
+    }
+}
+
 BoardAccessFault::BoardAccessFault( const AFV& afv )
     : Chm6BoardFault(afv.boardFaultId
                    , afv.bSim
                    , afv.fCondition)
     , regAddr_(afv.registerAddr)
     , mspRegIfDvr(afv.devicePtr)
+    , mBus(AccessFaultBus(afv.boardFaultId))
     , deviceAddress_(afv.devicePtr->GetDevAddr())
     , curDevAddr_(deviceAddress_)
     , mEnabled(false)
     , fidName_(afv.fidName)
+    , mIsProbeEngineEn(false)
+    , mGoodReadCount(0)
+    , mProbeVerdict(FAULT_UNKNOWN)
     {
         assert((nullptr != mspRegIfDvr));
 
@@ -852,7 +955,10 @@ void BoardAccessFault::SetDevAddr(const uint32& devaddr)
          << " : Setting DevAddr to: "
          << std::hex << curDevAddr_;
 
-    mspRegIfDvr->SetDevAddr(curDevAddr_);
+    {
+        I2cTransaction txn(mBus, I2C_PRIO_FAULT);
+        mspRegIfDvr->SetDevAddr(curDevAddr_);
+    }
     mEnabled = true;
 
     DLOG << "mEnabled = " << mEnabled;
@@ -876,13 +982,82 @@ void BoardAccessFault::TestAccess()
          << " : reg address: " << std::hex << regAddr_
          << " @ dev address: " << std::hex << curDevAddr_;
 
+    I2cTransaction txn(mBus, I2C_PRIO_FAULT);
+
     mspRegIfDvr->Read8(regAddr_);
 }
 
+void BoardAccessFault::ProbeOnce()
+{
+    std::string errLog;
+    try
+    {
+        TestAccess();
+
+        // N good reads in a row, spread over cycles, clear the fault
+        if (mGoodReadCount < cNumGoodReadsToClear)
+        {
+            ++mGoodReadCount;
+        }
+
+        if (mGoodReadCount >= cNumGoodReadsToClear)
+        {
+            mProbeVerdict = FAULT_CLEAR;
+        }
+
+        return;
+    }
+    catch (regIf::RegIfException &ex)
+    {
+        errLog = "Error: Fpga Access Failed. Ex: " + std::to_string(ex.GetError());
+    }
+    catch(exception& ex)
+    {
+        std::string exStr(ex.what());
+        errLog =  "Caught Exception: " + exStr;
+    }
+    catch( ... )
+    {
+        errLog = "Caught Exception";
+    }
+
+    if (mProbeVerdict != FAULT_SET)
+    {
+        INFN_LOG(SeverityLevel::error) << errLog;
+
+        INFN_LOG(SeverityLevel::error) << "FAULT DETECTED for Fault: "
+                        << fidName_ << " : " << mId
+                        << " Dev Addr: " << curDevAddr_
+                        << " Reg Addr: " << regAddr_
+                        << " Good Read Count: " << mGoodReadCount.load();
+    }
+
+    mGoodReadCount = 0;
+    mProbeVerdict = FAULT_SET;
+}
+
+void BoardAccessFault::SetProbeHung()
+{
+    if (mProbeVerdict != FAULT_SET)
+    {
+        INFN_LOG(SeverityLevel::error) << "FAULT DETECTED for Fault: "
+                        << fidName_ << " : " << mId
+                        << " Bus access did not complete";
+    }
+
+    mGoodReadCount = 0;
+    mProbeVerdict = FAULT_SET;
+}
+
 faultConditionType BoardAccessFault::CheckFault()
 {
     DLOG << fidName_ << " : " << mId;
 
+    if (mIsProbeEngineEn)
+    {
+        return mProbeVerdict;
+    }
+
     const int numAccessAttempts = 10;
     const int sleepMS = 10;
 
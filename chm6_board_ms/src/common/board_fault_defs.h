@@ -9,6 +9,7 @@
 #ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_FAULT_DEFS_H_
 #define CHM6_BOARD_MS_SRC_COMMON_BOARD_FAULT_DEFS_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,6 +19,7 @@
 
 #include "types.h"
 #include "board_common_driver.h"    // alarm reg access
+#include "Tmp112Sampler.h"          // cached TMP112 alert state
 #include "RegIfException.h"
 
 namespace boardMs
@@ -363,6 +365,13 @@ public:
 
     virtual void CheckFaultCondition();
 
+    // Check against inputs captured for this cycle.
+    // Faults not driven by digital inputs do their own check.
+    virtual void CheckFaultCondition(const DigitalInputSnapshot& snapshot)
+    {
+        CheckFaultCondition();
+    }
+
     static std::string BoardFaultIdToName(BoardFaultId id);
 
     static std::string BoardFltCondiToStr(faultConditionType type);
@@ -395,6 +404,8 @@ protected:
 
     virtual faultConditionType CheckFault();
 
+    void UpdateCondition(faultConditionType newCondition);
+
     BoardFaultId        mId;
     std::string         mName;
     faultConditionType  mCondition;
@@ -424,12 +435,19 @@ public:
 
     virtual ~BoardFaultFpga() {}
 
+    using Chm6BoardFault::CheckFaultCondition;
+
+    virtual void CheckFaultCondition(const DigitalInputSnapshot& snapshot);
+
 protected:
 
     virtual faultConditionType CheckFault();
     virtual faultConditionType GetFaultState();
 
+    faultConditionType EvalFaultState(uint32 regVal);
+
     virtual int GetRegValue(const uint32 &regVal);
+    virtual int GetSnapshotValue(const DigitalInputSnapshot& snapshot, uint32 &regVal);
 
     uint32 mInputMsk;
     uint32 mInputPol;
@@ -452,10 +470,35 @@ public:
 protected:
 
     virtual int GetRegValue(const uint32 &regVal);
+    virtual int GetSnapshotValue(const DigitalInputSnapshot& snapshot, uint32 &regVal);
 
     mezzBoardIdType mMezzBrdId;
 };
 
+/*
+ * Over temperature from a TMP112 in comparator mode.
+ * State comes from the sampler cache; no I2C access on the fault thread.
+ */
+class BoardFaultTmpAlert : public Chm6BoardFault
+{
+public:
+
+    BoardFaultTmpAlert(BoardFaultId id,
+                       Tmp112Sampler* pSampler,
+                       Tmp112SensorType sensorType,
+                       bool isSimEn,
+                       faultConditionType condition = FAULT_CLEAR);
+
+    virtual ~BoardFaultTmpAlert() {}
+
+protected:
+
+    virtual faultConditionType CheckFault();
+
+    Tmp112Sampler*   mpSampler;
+    Tmp112SensorType mSensorType;
+};
+
 
 struct AFV
 {
@@ -640,6 +683,22 @@ public:
     void RestoreDevAddr();
     inline const bool IsEnabled() { return mEnabled; }
 
+    /*
+     * Probe engine mode: probes run on a bus worker thread and
+     * CheckFault() just returns the latest verdict without bus access.
+     */
+    void SetProbeEngineEnable(bool isEn) { mIsProbeEngineEn = isEn; }
+
+    // One access attempt; called from the bus worker thread
+    void ProbeOnce();
+
+    // Bus worker did not return within its budget
+    void SetProbeHung();
+
+    RegBusType GetBus() const { return mBus; }
+
+    static const uint32 cNumGoodReadsToClear = 10;
+
 protected:
     virtual faultConditionType CheckFault();
     virtual void TestAccess();
@@ -656,11 +715,23 @@ protected:
     // Pointer to the device interface.
     std::shared_ptr<DevI2cIf> mspRegIfDvr;
 
+    // Bus the device sits on; each test access is one transaction on it.
+    const RegBusType mBus;
+
     // Sim enabled flag.
     bool mEnabled;
 
     // Fault Name
     std::string fidName_;
+
+    // Probe engine mode
+    bool mIsProbeEngineEn;
+
+    // Consecutive good reads seen by the probe engine
+    std::atomic<uint32> mGoodReadCount;
+
+    // Latest verdict from the bus worker
+    std::atomic<faultConditionType> mProbeVerdict;
 };
 //
 // END class BoardAccessFault
@@ -0,0 +1,234 @@
+/*
+ * board_i2c_sched.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <cstring>
+#include <boost/format.hpp>
+
+#include "board_i2c_sched.h"
+
+BoardI2cSched& BoardI2cSched::getInstance()
+{
+    static BoardI2cSched theInstance;
+    return theInstance;
+}
+
+BoardI2cSched::BoardI2cSched()
+{
+    for (auto& sched : maBuses)
+    {
+        sched.mDepth     = 0;
+        sched.mOwnerPrio = I2C_PRIO_DIAG;
+
+        for (uint32 i = 0; i < NUM_I2C_PRIOS; i++)
+        {
+            sched.maNumWaiting[i] = 0;
+            sched.maNextTicket[i] = 0;
+            sched.maNowServing[i] = 0;
+        }
+
+        memset(sched.maStats, 0, sizeof(sched.maStats));
+    }
+}
+
+bool BoardI2cSched::IsGrantable(const BusSched& sched, I2cPrioType prio, uint64 ticket) const
+{
+    if ((sched.mDepth != 0) || (sched.maNowServing[prio] != ticket))
+    {
+        return false;
+    }
+
+    for (uint32 i = 0; i < prio; i++)
+    {
+        if (sched.maNumWaiting[i] != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void BoardI2cSched::Acquire(RegBusType bus, I2cPrioType prio)
+{
+    BusSched& sched = maBuses[bus];
+
+    std::unique_lock<std::mutex> lock(sched.mLock);
+
+    if ((sched.mDepth != 0) && (sched.mOwner == std::this_thread::get_id()))
+    {
+        // Nested; the outer transaction already owns the bus
+        sched.mDepth++;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    uint64 ticket = sched.maNextTicket[prio]++;
+    sched.maNumWaiting[prio]++;
+
+    sched.mCond.wait(lock, [&]{ return IsGrantable(sched, prio, ticket); });
+
+    sched.maNumWaiting[prio]--;
+    sched.maNowServing[prio]++;
+
+    sched.mOwner     = std::this_thread::get_id();
+    sched.mDepth     = 1;
+    sched.mOwnerPrio = prio;
+    sched.mGrantTime = std::chrono::steady_clock::now();
+
+    uint64 waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        sched.mGrantTime - start).count();
+
+    ClassStats& stats = sched.maStats[prio];
+
+    stats.mNumTxns++;
+    stats.mWaitNs += waitNs;
+    if (waitNs > stats.mMaxWaitNs)
+    {
+        stats.mMaxWaitNs = waitNs;
+    }
+}
+
+void BoardI2cSched::Release(RegBusType bus)
+{
+    BusSched& sched = maBuses[bus];
+
+    bool isNotify = false;
+    {
+        std::lock_guard<std::mutex> guard(sched.mLock);
+
+        if ((sched.mDepth == 0) || (--sched.mDepth != 0))
+        {
+            return;
+        }
+
+        uint64 holdNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - sched.mGrantTime).count();
+
+        ClassStats& stats = sched.maStats[sched.mOwnerPrio];
+
+        stats.mHoldNs += holdNs;
+        if (holdNs > stats.mMaxHoldNs)
+        {
+            stats.mMaxHoldNs = holdNs;
+        }
+
+        for (uint32 i = 0; i < NUM_I2C_PRIOS; i++)
+        {
+            isNotify |= (sched.maNumWaiting[i] != 0);
+        }
+    }
+
+    // Waiters of every class recheck; only the head of the top class proceeds
+    if (isNotify)
+    {
+        sched.mCond.notify_all();
+    }
+}
+
+void BoardI2cSched::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardI2cSched.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    os << boost::format("%-8s : %-6s : %10s : %7s : %12s : %12s : %12s : %12s")
+          % "Bus" % "Class" % "Txns" % "Waiting" % "AvgWait(us)" % "MaxWait(us)"
+          % "AvgHold(us)" % "MaxHold(us)" << std::endl;
+
+    for (uint32 bus = 0; bus < NUM_REG_BUSES; bus++)
+    {
+        if (!IsScheduled(RegBusType(bus)))
+        {
+            continue;
+        }
+
+        BusSched& sched = maBuses[bus];
+
+        std::lock_guard<std::mutex> guard(sched.mLock);
+
+        for (uint32 prio = 0; prio < NUM_I2C_PRIOS; prio++)
+        {
+            const ClassStats& stats = sched.maStats[prio];
+
+            if ((stats.mNumTxns == 0) && (sched.maNumWaiting[prio] == 0))
+            {
+                continue;
+            }
+
+            uint64 numTxns = (stats.mNumTxns ? stats.mNumTxns : 1);
+
+            os << boost::format("%-8s : %-6s : %10d : %7d : %12.1f : %12.1f : %12.1f : %12.1f")
+                  % BoardRegStats::BusToStr(RegBusType(bus))
+                  % PrioToStr(I2cPrioType(prio))
+                  % stats.mNumTxns
+                  % sched.maNumWaiting[prio]
+                  % (stats.mWaitNs / 1e3 / numTxns)
+                  % (stats.mMaxWaitNs / 1e3)
+                  % (stats.mHoldNs / 1e3 / numTxns)
+                  % (stats.mMaxHoldNs / 1e3) << std::endl;
+        }
+    }
+}
+
+void BoardI2cSched::Reset()
+{
+    for (auto& sched : maBuses)
+    {
+        std::lock_guard<std::mutex> guard(sched.mLock);
+
+        memset(sched.maStats, 0, sizeof(sched.maStats));
+    }
+}
+
+bool BoardI2cSched::IsScheduled(RegBusType bus)
+{
+    switch (bus)
+    {
+        case REG_BUS_PL_I2C0:
+        case REG_BUS_PL_I2C1:
+        case REG_BUS_PL_I2C2:
+        case REG_BUS_PL_I2C3:
+        case REG_BUS_PL_I2C4:
+        case REG_BUS_PS_I2C0:
+            return true;
+        default:
+            return false;
+    }
+}
+
+I2cPrioType BoardI2cSched::CallerToPrio(RegCallerType caller)
+{
+    switch (caller)
+    {
+        case REG_CALLER_FAULT_POLL:
+            return I2C_PRIO_FAULT;
+        case REG_CALLER_LED:
+            return I2C_PRIO_LED;
+        case REG_CALLER_CLI:
+            return I2C_PRIO_DIAG;
+        case REG_CALLER_PM:
+        case REG_CALLER_INIT:
+        case REG_CALLER_OTHER:
+        default:
+            return I2C_PRIO_PM;
+    }
+}
+
+std::string BoardI2cSched::PrioToStr(I2cPrioType prio)
+{
+    switch (prio)
+    {
+        case I2C_PRIO_FAULT:
+            return std::string("fault");
+        case I2C_PRIO_PM:
+            return std::string("pm");
+        case I2C_PRIO_LED:
+            return std::string("led");
+        case I2C_PRIO_DIAG:
+            return std::string("diag");
+        default:
+            return std::string("unknown");
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * board_i2c_sched.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_I2C_SCHED_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_I2C_SCHED_H_
+
+#include <iostream>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
+#include "types.h"
+#include "board_reg_stats.h"
+
+// Service classes, highest first
+typedef enum I2cPrioType
+{
+    I2C_PRIO_FAULT = 0,    // Fault detection
+    I2C_PRIO_PM,           // PM, init and other background work
+    I2C_PRIO_LED,          // LED state
+    I2C_PRIO_DIAG,         // CLI and diag
+    NUM_I2C_PRIOS
+} I2cPrioType;
+
+/*
+ * Transaction arbiter for the FPGA I2C controllers, one queue per bus.
+ * A transaction is whatever runs while the grant is held, normally a
+ * device select and its access, and it runs on the caller's thread.
+ * Grants go strictly by class, then FIFO within a class, so a CLI dump
+ * made of many transactions holds off a fault read by at most the one
+ * transaction in flight. Grants nest on the owning thread. FPGA and MDIO
+ * accesses are not arbitrated here.
+ */
+class BoardI2cSched
+{
+public:
+
+    static BoardI2cSched& getInstance();
+
+    void Acquire(RegBusType bus, I2cPrioType prio);
+
+    void Release(RegBusType bus);
+
+    void Dump(std::ostream& os);
+
+    void Reset();
+
+    static bool IsScheduled(RegBusType bus);
+
+    static I2cPrioType CallerToPrio(RegCallerType caller);
+
+    static std::string PrioToStr(I2cPrioType prio);
+
+private:
+
+    struct ClassStats
+    {
+        uint64 mNumTxns;
+        uint64 mWaitNs;
+        uint64 mMaxWaitNs;
+        uint64 mHoldNs;
+        uint64 mMaxHoldNs;
+    };
+
+    struct BusSched
+    {
+        std::mutex              mLock;
+        std::condition_variable mCond;
+
+        // Owner and depth are only valid while mDepth is non zero
+        std::thread::id mOwner;
+        uint32          mDepth;
+        I2cPrioType     mOwnerPrio;
+
+        std::chrono::steady_clock::time_point mGrantTime;
+
+        uint32 maNumWaiting[NUM_I2C_PRIOS];
+        uint64 maNextTicket[NUM_I2C_PRIOS];
+        uint64 maNowServing[NUM_I2C_PRIOS];
+
+        ClassStats maStats[NUM_I2C_PRIOS];
+    };
+
+    BoardI2cSched();
+
+    ~BoardI2cSched() {}
+
+    bool IsGrantable(const BusSched& sched, I2cPrioType prio, uint64 ticket) const;
+
+    BusSched maBuses[NUM_REG_BUSES];
+};
+
+/*
+ * Holds the bus for the scope. Without a class the thread's
+ * RegCallerScope tag picks one.
+ */
+class I2cTransaction
+{
+public:
+
+    explicit I2cTransaction(RegBusType bus)
+        : I2cTransaction(bus, BoardI2cSched::CallerToPrio(BoardRegStats::GetCaller()))
+    {}
+
+    I2cTransaction(RegBusType bus, I2cPrioType prio)
+        : mBus(bus)
+    {
+        if (BoardI2cSched::IsScheduled(mBus))
+        {
+            BoardI2cSched::getInstance().Acquire(mBus, prio);
+        }
+    }
+
+    ~I2cTransaction()
+    {
+        if (BoardI2cSched::IsScheduled(mBus))
+        {
+            BoardI2cSched::getInstance().Release(mBus);
+        }
+    }
+
+    I2cTransaction(const I2cTransaction&) = delete;
+
+    I2cTransaction& operator=(const I2cTransaction&) = delete;
+
+private:
+
+    RegBusType mBus;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_I2C_SCHED_H_ */
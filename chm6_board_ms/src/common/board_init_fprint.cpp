@@ -0,0 +1,219 @@
+/*
+ * board_init_fprint.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <boost/format.hpp>
+
+#include "board_init_fprint.h"
+#include "InfnLogger.h"
+
+const uint32 BoardInitFprint::cHashSeed;
+
+// Must outlive a CPU reset; BoardInitFprintFile env overrides
+const char* cInitFprintFile       = "/var/log/chm6_board_init_fprint.bin";
+const char* cInitFprintFileEnvStr = "BoardInitFprintFile";
+
+const uint32 cInitFprintMagic   = 0x42465052; // "BFPR"
+const uint32 cInitFprintVersion = 1;
+
+BoardInitFprint& BoardInitFprint::getInstance()
+{
+    static BoardInitFprint theInstance;
+    return theInstance;
+}
+
+BoardInitFprint::BoardInitFprint()
+    : mpRec(nullptr)
+{
+}
+
+BoardInitFprint::~BoardInitFprint()
+{
+    if (mpRec)
+    {
+        munmap(mpRec, sizeof(InitFprintRecord));
+    }
+}
+
+int BoardInitFprint::Open()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if (mpRec)
+    {
+        return 0;
+    }
+
+    const char* pEnvStr = getenv(cInitFprintFileEnvStr);
+
+    mFileName = (pEnvStr ? pEnvStr : cInitFprintFile);
+
+    int fd = open(mFileName.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to open init fingerprint " << mFileName
+                                       << " errno: " << errno;
+        return -1;
+    }
+
+    struct stat st;
+
+    if ((fstat(fd, &st) != 0) ||
+        (((size_t)st.st_size != sizeof(InitFprintRecord)) && (ftruncate(fd, sizeof(InitFprintRecord)) != 0)))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to size init fingerprint " << mFileName
+                                       << " errno: " << errno;
+        close(fd);
+        return -1;
+    }
+
+    void* pMap = mmap(nullptr, sizeof(InitFprintRecord), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (pMap == MAP_FAILED)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to map init fingerprint " << mFileName
+                                       << " errno: " << errno;
+        return -1;
+    }
+
+    mpRec = static_cast<InitFprintRecord*>(pMap);
+
+    return 0;
+}
+
+bool BoardInitFprint::Get(InitFprintRecord& rec)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if ((mpRec == nullptr) ||
+        (mpRec->mMagic != cInitFprintMagic) ||
+        (mpRec->mVersion != cInitFprintVersion) ||
+        (mpRec->mIsValid == 0))
+    {
+        return false;
+    }
+
+    rec = *mpRec;
+
+    return true;
+}
+
+void BoardInitFprint::Save(const InitFprintRecord& rec)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if (mpRec == nullptr)
+    {
+        return;
+    }
+
+    // Body first; valid only once the rest reached flash
+    *mpRec = rec;
+    mpRec->mMagic   = cInitFprintMagic;
+    mpRec->mVersion = cInitFprintVersion;
+    mpRec->mIsValid = 0;
+    mpRec->mRealSec = time(NULL);
+    Sync();
+
+    mpRec->mIsValid = 1;
+    Sync();
+}
+
+void BoardInitFprint::Invalidate()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if ((mpRec == nullptr) || (mpRec->mIsValid == 0))
+    {
+        return;
+    }
+
+    mpRec->mIsValid = 0;
+    Sync();
+}
+
+void BoardInitFprint::Sync()
+{
+    if (msync(mpRec, sizeof(InitFprintRecord), MS_SYNC) != 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to sync init fingerprint " << mFileName
+                                       << " errno: " << errno;
+    }
+}
+
+uint32 BoardInitFprint::Hash(const void* pData, size_t len, uint32 hash)
+{
+    const uint8* pByte = static_cast<const uint8*>(pData);
+
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= pByte[i];
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+void BoardInitFprint::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardInitFprint.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    Open();
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    if (mpRec == nullptr)
+    {
+        os << "Init fingerprint is not open" << std::endl;
+        return;
+    }
+
+    char timeStr[32];
+    time_t realSec = mpRec->mRealSec;
+    struct tm tmTime;
+    strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", localtime_r(&realSec, &tmTime));
+
+    bool isKnown = ((mpRec->mMagic == cInitFprintMagic) && (mpRec->mVersion == cInitFprintVersion));
+
+    os << "File        : " << mFileName << std::endl;
+    os << "Valid       : " << ((isKnown && mpRec->mIsValid) ? "yes" : "no") << std::endl;
+
+    if (!isKnown)
+    {
+        return;
+    }
+
+    os << "Saved       : " << timeStr << std::endl;
+    os << boost::format("Reset Cause : 0x%x") % mpRec->mResetCause << std::endl;
+    os << "Mezz Spec   : " << mpRec->mMezzSpec << std::endl;
+    os << boost::format("Fpga Ver    : 0x%08x") % mpRec->mFpgaVerHash << std::endl;
+    os << boost::format("Mezz Latch  : 0x%08x") % mpRec->mMezzLatch << std::endl << std::endl;
+
+    os << boost::format("%-4s : %4s : %-10s : %-10s : %-10s")
+          % "Mezz" % "Init" % "Si5394Cfg" % "GbFwVer" % "GbFwCrc" << std::endl;
+
+    for (uint32 i = 0; i < boardMs::NUM_MEZZ_BRD_TYPES; i++)
+    {
+        const InitFprintMezz& mezz = mpRec->maMezz[i];
+
+        os << boost::format("%-4d : %4d : 0x%08x : 0x%08x : 0x%08x")
+              % i
+              % mezz.mIsInit
+              % mezz.mSi5394CfgHash
+              % mezz.mGbFwVer
+              % mezz.mGbFwCrc << std::endl;
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * board_init_fprint.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_INIT_FPRINT_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_INIT_FPRINT_H_
+
+#include <iostream>
+#include <string>
+#include <mutex>
+
+#include "types.h"
+#include "board_defs.h"
+
+// What one mezz was left running by the last good init
+struct InitFprintMezz
+{
+    uint32 mIsInit;           // 1 if this init brought the mezz up
+    uint32 mSi5394CfgHash;    // Hash of the Si5394 register list configured
+    uint32 mGbFwVer;          // Firmware on every gearbox core of the mezz
+    uint32 mGbFwCrc;
+};
+
+// Fixed width; the whole fingerprint is one mapped page
+struct InitFprintRecord
+{
+    uint32 mMagic;
+    uint32 mVersion;
+    uint32 mIsValid;          // Set when init completes, cleared when a cold init starts
+    uint32 mRealSec;          // CLOCK_REALTIME at save
+    uint32 mResetCause;
+    uint32 mMezzSpec;         // boardMs::mezzBoardSpecType
+    uint32 mFpgaVerHash;      // Hash of the FPGA version string
+    uint32 mMezzLatch;        // FPGA latch mezz power enable and reset bits
+    InitFprintMezz maMezz[boardMs::NUM_MEZZ_BRD_TYPES];
+};
+
+/*
+ * Hardware init fingerprint, persisted in a MAP_SHARED file on the
+ * persistent partition. Board init saves it after a good cold or warm
+ * init; the next warm init compares it against the hardware and only
+ * re-initializes the parts that no longer match.
+ */
+class BoardInitFprint
+{
+public:
+
+    static BoardInitFprint& getInstance();
+
+    // Map the fingerprint file; a missing or foreign file reads as invalid
+    int Open();
+
+    // Copy of the saved fingerprint; false if none or invalidated
+    bool Get(InitFprintRecord& rec);
+
+    void Save(const InitFprintRecord& rec);
+
+    void Invalidate();
+
+    void Dump(std::ostream& os);
+
+    // FNV-1a, chainable through hash
+    static uint32 Hash(const void* pData, size_t len, uint32 hash = cHashSeed);
+
+    static uint32 Hash(const std::string& str) { return Hash(str.data(), str.size()); }
+
+    // Hash of each element of a register list, in order
+    template <typename T>
+    static uint32 HashList(const T& list)
+    {
+        uint32 hash = cHashSeed;
+
+        for (auto& elem : list)
+        {
+            hash = Hash(&elem, sizeof(elem), hash);
+        }
+
+        return hash;
+    }
+
+    static const uint32 cHashSeed = 0x811C9DC5;
+
+private:
+
+    BoardInitFprint();
+
+    ~BoardInitFprint();
+
+    void Sync();
+
+    std::mutex mLock;
+
+    InitFprintRecord* mpRec;
+
+    std::string mFileName;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_INIT_FPRINT_H_ */
@@ -0,0 +1,359 @@
+/*
+ * board_journal.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <boost/format.hpp>
+
+#include "board_journal.h"
+#include "board_fault_defs.h"
+#include "board_boot_prof.h"
+#include "InfnLogger.h"
+
+const uint32 BoardJournal::cNumEventRecords;
+const uint32 BoardJournal::cNumPmRecords;
+
+// Default on the persistent partition; BoardJournalFile env overrides
+const char* cJournalFile       = "/var/log/chm6_board_journal.bin";
+const char* cJournalFileEnvStr = "BoardJournalFile";
+
+const uint32 cJournalMagic   = 0x424A524E; // "BJRN"
+const uint32 cJournalVersion = 1;
+
+BoardJournal& BoardJournal::getInstance()
+{
+    static BoardJournal theInstance;
+    return theInstance;
+}
+
+BoardJournal::BoardJournal()
+    : mIsOpen(false)
+    , mpBase(nullptr)
+    , mSize(0)
+    , mpRing{nullptr, nullptr}
+    , mNumRecords{cNumEventRecords, cNumPmRecords}
+{
+    for (auto& nextSeq : mNextSeq)
+    {
+        nextSeq = 1;
+    }
+}
+
+BoardJournal::~BoardJournal()
+{
+    mIsOpen = false;
+
+    if (mpBase)
+    {
+        munmap(mpBase, mSize);
+    }
+}
+
+int BoardJournal::Open()
+{
+    std::lock_guard<std::mutex> guard(mOpenLock);
+
+    if (mIsOpen)
+    {
+        return 0;
+    }
+
+    const char* pEnvStr = getenv(cJournalFileEnvStr);
+
+    mFileName = (pEnvStr ? pEnvStr : cJournalFile);
+
+    mSize = sizeof(JournalHeader);
+    for (uint32 i = 0; i < NUM_JOURNAL_RINGS; i++)
+    {
+        mSize += mNumRecords[i] * sizeof(BoardJournalRecord);
+    }
+
+    int fd = open(mFileName.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to open journal " << mFileName
+                                       << " errno: " << errno;
+        return -1;
+    }
+
+    struct stat st;
+
+    if ((fstat(fd, &st) != 0) ||
+        (((size_t)st.st_size != mSize) && (ftruncate(fd, mSize) != 0)))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to size journal " << mFileName
+                                       << " errno: " << errno;
+        close(fd);
+        return -1;
+    }
+
+    void* pMap = mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    // Mapping stays valid after close
+    close(fd);
+
+    if (pMap == MAP_FAILED)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to map journal " << mFileName
+                                       << " errno: " << errno;
+        return -1;
+    }
+
+    mpBase = static_cast<uint8*>(pMap);
+
+    mpRing[JOURNAL_RING_EVENT] = reinterpret_cast<BoardJournalRecord*>(mpBase + sizeof(JournalHeader));
+    mpRing[JOURNAL_RING_PM]    = mpRing[JOURNAL_RING_EVENT] + mNumRecords[JOURNAL_RING_EVENT];
+
+    if (IsHeaderValid())
+    {
+        RecoverSeq();
+    }
+    else
+    {
+        INFN_LOG(SeverityLevel::info) << "Formatting journal " << mFileName;
+        Format();
+    }
+
+    mIsOpen = true;
+
+    INFN_LOG(SeverityLevel::info) << "Journal " << mFileName << " size: " << mSize
+                                  << " next event seq: " << mNextSeq[JOURNAL_RING_EVENT]
+                                  << " next pm seq: " << mNextSeq[JOURNAL_RING_PM];
+
+    return 0;
+}
+
+void BoardJournal::Record(BoardJournalRecType type, uint16 id, uint64 value)
+{
+    Append(JOURNAL_RING_EVENT, type, id, value);
+}
+
+void BoardJournal::RecordPm(uint16 id, float64 value)
+{
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    Append(JOURNAL_RING_PM, JOURNAL_REC_PM, id, bits);
+}
+
+void BoardJournal::Append(BoardJournalRingType ring, BoardJournalRecType type, uint16 id, uint64 value)
+{
+    if (!mIsOpen)
+    {
+        return;
+    }
+
+    BoardJournalRecord rec;
+
+    rec.mSeq = mNextSeq[ring].fetch_add(1, std::memory_order_relaxed);
+
+    // vDSO clocks; no syscall
+    struct timespec mono, real;
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+    clock_gettime(CLOCK_REALTIME, &real);
+
+    rec.mMonoNs  = (uint64)mono.tv_sec * 1000000000ULL + mono.tv_nsec;
+    rec.mRealSec = real.tv_sec;
+    rec.mType    = type;
+    rec.mId      = id;
+    rec.mValue   = value;
+
+    memcpy(&mpRing[ring][(rec.mSeq - 1) % mNumRecords[ring]], &rec, sizeof(rec));
+}
+
+void BoardJournal::Flush(bool isSync)
+{
+    if (!mIsOpen)
+    {
+        return;
+    }
+
+    if (msync(mpBase, mSize, (isSync ? MS_SYNC : MS_ASYNC)) != 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to flush journal errno: " << errno;
+    }
+}
+
+void BoardJournal::Format()
+{
+    memset(mpBase, 0, mSize);
+
+    JournalHeader* pHdr = reinterpret_cast<JournalHeader*>(mpBase);
+
+    pHdr->mMagic      = cJournalMagic;
+    pHdr->mVersion    = cJournalVersion;
+    pHdr->mRecordSize = sizeof(BoardJournalRecord);
+
+    for (uint32 i = 0; i < NUM_JOURNAL_RINGS; i++)
+    {
+        pHdr->mNumRecords[i] = mNumRecords[i];
+        mNextSeq[i] = 1;
+    }
+}
+
+bool BoardJournal::IsHeaderValid()
+{
+    const JournalHeader* pHdr = reinterpret_cast<const JournalHeader*>(mpBase);
+
+    if ((pHdr->mMagic != cJournalMagic) ||
+        (pHdr->mVersion != cJournalVersion) ||
+        (pHdr->mRecordSize != sizeof(BoardJournalRecord)))
+    {
+        return false;
+    }
+
+    for (uint32 i = 0; i < NUM_JOURNAL_RINGS; i++)
+    {
+        if (pHdr->mNumRecords[i] != mNumRecords[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// One scan at open; continue after the newest record of the last run
+void BoardJournal::RecoverSeq()
+{
+    for (uint32 i = 0; i < NUM_JOURNAL_RINGS; i++)
+    {
+        uint64 maxSeq = 0;
+
+        for (uint32 n = 0; n < mNumRecords[i]; n++)
+        {
+            if (mpRing[i][n].mSeq > maxSeq)
+            {
+                maxSeq = mpRing[i][n].mSeq;
+            }
+        }
+
+        mNextSeq[i] = maxSeq + 1;
+    }
+}
+
+void BoardJournal::Dump(std::ostream& os, BoardJournalRingType ring, uint32 numRecs,
+                        boost::function<std::string(uint16 type, uint16 id)> idToName)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardJournal.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    if (!mIsOpen || (ring >= NUM_JOURNAL_RINGS))
+    {
+        os << "Journal is not open" << std::endl;
+        return;
+    }
+
+    uint64 nextSeq = mNextSeq[ring];
+
+    os << "File: " << mFileName << " Ring: " << (ring == JOURNAL_RING_EVENT ? "event" : "pm")
+       << " Size: " << mNumRecords[ring] << " Next seq: " << nextSeq << std::endl << std::endl;
+
+    numRecs = std::min(numRecs, mNumRecords[ring]);
+
+    uint64 firstSeq = (nextSeq > numRecs) ? (nextSeq - numRecs) : 1;
+
+    os << boost::format("%10s : %-19s : %14s : %-11s : %-32s : %s")
+          % "Seq" % "Time" % "Mono(s)" % "Type" % "Id" % "Value" << std::endl;
+
+    for (uint64 seq = firstSeq; seq < nextSeq; seq++)
+    {
+        BoardJournalRecord rec;
+        memcpy(&rec, &mpRing[ring][(seq - 1) % mNumRecords[ring]], sizeof(rec));
+
+        // Skip slots overwritten or torn by a crash
+        if (rec.mSeq != seq)
+        {
+            continue;
+        }
+
+        char timeStr[32];
+        time_t realSec = rec.mRealSec;
+        struct tm tmTime;
+        strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", localtime_r(&realSec, &tmTime));
+
+        std::string idStr;
+        if (idToName)
+        {
+            idStr = idToName(rec.mType, rec.mId);
+        }
+
+        if (idStr.empty())
+        {
+            if (rec.mType == JOURNAL_REC_FAULT)
+            {
+                idStr = boardMs::Chm6BoardFault::BoardFaultIdToName((boardMs::BoardFaultId)rec.mId);
+            }
+            else if (rec.mType == JOURNAL_REC_BOOT_PHASE)
+            {
+                idStr = BoardBootProf::PhaseToStr((BootPhaseType)rec.mId);
+            }
+            else
+            {
+                idStr = std::to_string(rec.mId);
+            }
+        }
+
+        std::string valueStr;
+        switch (rec.mType)
+        {
+            case JOURNAL_REC_BOOT:
+                valueStr = (boost::format("reset cause 0x%x") % rec.mValue).str();
+                break;
+            case JOURNAL_REC_FAULT:
+                valueStr = boardMs::Chm6BoardFault::BoardFltCondiToStr((boardMs::faultConditionType)rec.mValue);
+                break;
+            case JOURNAL_REC_PM:
+            {
+                float64 value;
+                memcpy(&value, &rec.mValue, sizeof(value));
+                valueStr = (boost::format("%.4f") % value).str();
+                break;
+            }
+            case JOURNAL_REC_BOOT_PHASE:
+                valueStr = (boost::format("%.1f ms") % (rec.mValue / 1e3)).str();
+                break;
+            default:
+                break;
+        }
+
+        os << boost::format("%10d : %-19s : %14.6f : %-11s : %-32s : %s")
+              % rec.mSeq
+              % timeStr
+              % (rec.mMonoNs / 1e9)
+              % RecTypeToStr(rec.mType)
+              % idStr
+              % valueStr << std::endl;
+    }
+}
+
+std::string BoardJournal::RecTypeToStr(uint16 type)
+{
+    switch (type)
+    {
+        case JOURNAL_REC_BOOT:
+            return std::string("BOOT");
+        case JOURNAL_REC_FAULT:
+            return std::string("FAULT");
+        case JOURNAL_REC_HOST_ACTION:
+            return std::string("HOST_ACTION");
+        case JOURNAL_REC_DCO_ACTION:
+            return std::string("DCO_ACTION");
+        case JOURNAL_REC_PM:
+            return std::string("PM");
+        case JOURNAL_REC_BOOT_PHASE:
+            return std::string("BOOT_PHASE");
+        default:
+            return std::string("Unknown");
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * board_journal.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_JOURNAL_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_JOURNAL_H_
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <boost/function.hpp>
+
+#include "types.h"
+
+typedef enum BoardJournalRingType
+{
+    JOURNAL_RING_EVENT = 0,
+    JOURNAL_RING_PM,
+    NUM_JOURNAL_RINGS
+} BoardJournalRingType;
+
+typedef enum BoardJournalRecType
+{
+    JOURNAL_REC_NONE = 0,
+    JOURNAL_REC_BOOT,          // id: boot reason   value: reset cause bits
+    JOURNAL_REC_FAULT,         // id: BoardFaultId  value: faultConditionType
+    JOURNAL_REC_HOST_ACTION,   // id: board action
+    JOURNAL_REC_DCO_ACTION,    // id: board action
+    JOURNAL_REC_PM,            // id: PM id         value: float64 bits
+    JOURNAL_REC_BOOT_PHASE,    // id: BootPhaseType value: duration us
+    NUM_JOURNAL_REC_TYPES
+} BoardJournalRecType;
+
+// Fixed width; a record is written with one memcpy
+struct BoardJournalRecord
+{
+    uint64 mSeq;       // Per ring, 0 if never written
+    uint64 mMonoNs;    // CLOCK_MONOTONIC, restarts after each boot record
+    uint32 mRealSec;   // CLOCK_REALTIME
+    uint16 mType;
+    uint16 mId;
+    uint64 mValue;
+};
+
+static_assert(sizeof(BoardJournalRecord) == 32, "BoardJournalRecord must stay 32 bytes");
+
+/*
+ * Fixed size ring file shared by board init and board ms. Records are
+ * copied into a MAP_SHARED mapping; the kernel writes dirty pages back,
+ * so flash writes are bounded by the file size per writeback interval
+ * and recording needs no syscall. Events and PM have separate rings so
+ * PM samples never push out fault history.
+ */
+class BoardJournal
+{
+public:
+
+    static BoardJournal& getInstance();
+
+    // Map the journal file; records are dropped until this succeeds
+    int Open();
+
+    void Record(BoardJournalRecType type, uint16 id, uint64 value = 0);
+
+    void RecordPm(uint16 id, float64 value);
+
+    // Push dirty pages to flash, e.g. before a restart
+    void Flush(bool isSync);
+
+    // Decode the last numRecs records of ring; idToName names ids of a record type
+    void Dump(std::ostream& os, BoardJournalRingType ring, uint32 numRecs,
+              boost::function<std::string(uint16 type, uint16 id)> idToName = 0);
+
+    static std::string RecTypeToStr(uint16 type);
+
+    static const uint32 cNumEventRecords = 8 * 1024;
+    static const uint32 cNumPmRecords    = 64 * 1024;
+
+private:
+
+    struct JournalHeader
+    {
+        uint32 mMagic;
+        uint32 mVersion;
+        uint32 mRecordSize;
+        uint32 mNumRecords[NUM_JOURNAL_RINGS];
+        uint8  mPad[44];
+    };
+
+    static_assert(sizeof(JournalHeader) == 64, "JournalHeader must stay 64 bytes");
+
+    BoardJournal();
+
+    ~BoardJournal();
+
+    void Format();
+
+    bool IsHeaderValid();
+
+    void RecoverSeq();
+
+    void Append(BoardJournalRingType ring, BoardJournalRecType type, uint16 id, uint64 value);
+
+    std::mutex mOpenLock;
+
+    std::atomic<bool> mIsOpen;
+
+    uint8* mpBase;
+
+    size_t mSize;
+
+    BoardJournalRecord* mpRing[NUM_JOURNAL_RINGS];
+
+    uint32 mNumRecords[NUM_JOURNAL_RINGS];
+
+    std::atomic<uint64> mNextSeq[NUM_JOURNAL_RINGS];
+
+    std::string mFileName;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_JOURNAL_H_ */
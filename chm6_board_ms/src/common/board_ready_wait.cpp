@@ -0,0 +1,150 @@
+/*
+ * board_ready_wait.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <boost/format.hpp>
+
+#include "board_ready_wait.h"
+#include "InfnLogger.h"
+
+BoardReadyWait& BoardReadyWait::getInstance()
+{
+    static BoardReadyWait theInstance;
+    return theInstance;
+}
+
+bool BoardReadyWait::PollOnce(const std::function<bool()>& isReady)
+{
+    try
+    {
+        return isReady();
+    }
+    catch ( ... )
+    {
+        return false;
+    }
+}
+
+int BoardReadyWait::WaitUntilReady(const ReadyWaitSpec& spec, const std::function<bool()>& isReady)
+{
+    auto start    = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::milliseconds(spec.mDeadlineMs);
+
+    if (spec.mSettleMs)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(spec.mSettleMs));
+    }
+
+    uint32 pollMs   = std::max(spec.mPollMs, 1u);
+    uint32 numPolls = 0;
+    bool   isDone   = false;
+
+    while (true)
+    {
+        numPolls++;
+
+        if (PollOnce(isReady))
+        {
+            isDone = true;
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        auto nap = std::min(std::chrono::steady_clock::duration(std::chrono::milliseconds(pollMs)),
+                            deadline - now);
+
+        std::this_thread::sleep_for(nap);
+
+        pollMs = std::min(pollMs * 2, std::max(spec.mMaxPollMs, pollMs));
+    }
+
+    uint64 waitUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+
+    getInstance().Record(spec.mpName, waitUs, numPolls, isDone);
+
+    if (!isDone)
+    {
+        INFN_LOG(SeverityLevel::warning) << spec.mpName << " not ready after " << (waitUs / 1000)
+                                         << " ms, " << numPolls << " polls";
+        return -1;
+    }
+
+    INFN_LOG(SeverityLevel::info) << spec.mpName << " ready after " << (waitUs / 1000)
+                                  << " ms, " << numPolls << " polls";
+
+    return 0;
+}
+
+void BoardReadyWait::Record(const char* pName, uint64 waitUs, uint32 numPolls, bool isReady)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    auto it = mStats.find(pName);
+
+    if (it == mStats.end())
+    {
+        WaitStats stats = {};
+        stats.mMinUs = waitUs;
+
+        it = mStats.insert(std::make_pair(std::string(pName), stats)).first;
+    }
+
+    WaitStats& stats = it->second;
+
+    stats.mNumWaits++;
+    stats.mNumPolls += numPolls;
+    stats.mLastUs    = waitUs;
+    stats.mTotalUs  += waitUs;
+    stats.mMinUs     = std::min(stats.mMinUs, waitUs);
+    stats.mMaxUs     = std::max(stats.mMaxUs, waitUs);
+
+    if (!isReady)
+    {
+        stats.mNumTimeouts++;
+    }
+}
+
+void BoardReadyWait::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardReadyWait.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    std::lock_guard<std::mutex> guard(mLock);
+
+    os << boost::format("%-28s : %6s : %8s : %8s : %10s : %10s : %10s : %10s")
+          % "Wait" % "Count" % "Timeouts" % "Polls" % "Last(ms)" % "Min(ms)" % "Avg(ms)" % "Max(ms)"
+       << std::endl;
+
+    for (auto& it : mStats)
+    {
+        const WaitStats& stats = it.second;
+
+        os << boost::format("%-28s : %6d : %8d : %8d : %10.1f : %10.1f : %10.1f : %10.1f")
+              % it.first
+              % stats.mNumWaits
+              % stats.mNumTimeouts
+              % stats.mNumPolls
+              % (stats.mLastUs / 1e3)
+              % (stats.mMinUs / 1e3)
+              % (stats.mTotalUs / 1e3 / stats.mNumWaits)
+              % (stats.mMaxUs / 1e3) << std::endl;
+    }
+}
+
+void BoardReadyWait::Reset()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mStats.clear();
+}
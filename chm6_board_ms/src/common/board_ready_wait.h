@@ -0,0 +1,77 @@
+/*
+ * board_ready_wait.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_READY_WAIT_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_READY_WAIT_H_
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <mutex>
+#include <functional>
+
+#include "types.h"
+
+struct ReadyWaitSpec
+{
+    const char* mpName;    // Stats key and log tag
+
+    uint32 mSettleMs;      // Always waited before the first poll
+
+    uint32 mPollMs;        // First poll interval; doubles on each miss
+
+    uint32 mMaxPollMs;     // Poll interval cap
+
+    uint32 mDeadlineMs;    // From the start of the wait, settle included
+};
+
+/*
+ * Replaces fixed bring-up sleeps: after the settle time the predicate is
+ * polled with exponential backoff until it holds or the deadline passes,
+ * so a step costs what the hardware needs rather than its worst case.
+ * An exception from the predicate counts as not ready, since devices in
+ * reset usually NACK. Each wait is recorded per spec name.
+ */
+class BoardReadyWait
+{
+public:
+
+    static BoardReadyWait& getInstance();
+
+    // Returns 0 once isReady() holds, -1 at the deadline
+    static int WaitUntilReady(const ReadyWaitSpec& spec, const std::function<bool()>& isReady);
+
+    void Dump(std::ostream& os);
+
+    void Reset();
+
+private:
+
+    struct WaitStats
+    {
+        uint64 mNumWaits;
+        uint64 mNumTimeouts;
+        uint64 mNumPolls;
+        uint64 mLastUs;
+        uint64 mMinUs;
+        uint64 mMaxUs;
+        uint64 mTotalUs;
+    };
+
+    BoardReadyWait() {}
+
+    ~BoardReadyWait() {}
+
+    static bool PollOnce(const std::function<bool()>& isReady);
+
+    void Record(const char* pName, uint64 waitUs, uint32 numPolls, bool isReady);
+
+    std::map<std::string, WaitStats> mStats;
+
+    std::mutex mLock;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_READY_WAIT_H_ */
@@ -0,0 +1,166 @@
+/*
+ * board_reg_probe.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_PROBE_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_PROBE_H_
+
+#include <string>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "types.h"
+#include "board_reg_stats.h"
+#include "board_i2c_sched.h"
+
+// U defers the member lookup so T need not have every method
+#define REG_PROBE_FWD(method, op)                                                \
+    template<typename U = T, typename... Args>                                   \
+    auto method(Args&&... args) const                                            \
+        -> decltype(std::declval<U&>().method(std::forward<Args>(args)...))      \
+    {                                                                            \
+        I2cTransaction txn(mBus);                                                \
+        RegAccessTimer timer(mSlot, op);                                         \
+        return mspIf->method(std::forward<Args>(args)...);                       \
+    }
+
+/*
+ * Holds a RegIf handle and times every access made through it. Call
+ * sites keep the shared_ptr syntax (probe->Read32()); get() hands the raw
+ * handle to device classes. Accesses on a bus handle are counted under
+ * the address from the last SetDevAddr. On an I2C bus each access is its
+ * own transaction; callers that select then access wrap the pair in an
+ * I2cTransaction.
+ */
+template<typename T>
+class RegIfProbe
+{
+public:
+
+    RegIfProbe(std::nullptr_t = nullptr)
+        : mBus(NUM_REG_BUSES)
+        , mSlot(BoardRegStats::cInvalidSlot)
+    {
+        for (auto& devSlot : maDevSlots)
+        {
+            devSlot = cNoDevSlot;
+        }
+    }
+
+    void Attach(std::shared_ptr<T> spIf, RegBusType bus, const std::string& name, uint32 devAddr = 0)
+    {
+        mspIf = spIf;
+        mBus  = bus;
+        mName = name;
+        mSlot = BoardRegStats::getInstance().AddDevice(bus, devAddr, name);
+    }
+
+    const RegIfProbe* operator->() const { return this; }
+
+    T* get() const { return mspIf.get(); }
+
+    explicit operator bool() const { return (mspIf != nullptr); }
+
+    RegBusType GetBus() const { return mBus; }
+
+    template<typename U = T, typename A>
+    auto SetDevAddr(A devAddr) const -> decltype(std::declval<U&>().SetDevAddr(devAddr))
+    {
+        I2cTransaction txn(mBus);
+        mSlot = GetDevSlot(devAddr);
+        return mspIf->SetDevAddr(devAddr);
+    }
+
+    template<typename U = T, typename... Args>
+    auto Configure(Args&&... args) const -> decltype(std::declval<U&>().Configure(std::forward<Args>(args)...))
+    {
+        return mspIf->Configure(std::forward<Args>(args)...);
+    }
+
+    REG_PROBE_FWD(Read,          REG_OP_READ)
+    REG_PROBE_FWD(Read8,         REG_OP_READ)
+    REG_PROBE_FWD(Read16,        REG_OP_READ)
+    REG_PROBE_FWD(Read32,        REG_OP_READ)
+    REG_PROBE_FWD(ReadByte,      REG_OP_READ)
+    REG_PROBE_FWD(ReadByteData,  REG_OP_READ)
+    REG_PROBE_FWD(ReadWordData,  REG_OP_READ)
+    REG_PROBE_FWD(ReadBlockData, REG_OP_READ)
+
+    REG_PROBE_FWD(Write,         REG_OP_WRITE)
+    REG_PROBE_FWD(Write8,        REG_OP_WRITE)
+    REG_PROBE_FWD(Write16,       REG_OP_WRITE)
+    REG_PROBE_FWD(Write32,       REG_OP_WRITE)
+    REG_PROBE_FWD(WriteByte,     REG_OP_WRITE)
+    REG_PROBE_FWD(WriteByteData, REG_OP_WRITE)
+    REG_PROBE_FWD(WriteWordData, REG_OP_WRITE)
+
+private:
+
+    // Stats slot of devAddr; registers the device only on first use
+    uint32 GetDevSlot(uint32 devAddr) const
+    {
+        uint64 entry = cNoDevSlot;
+
+        for (auto& devSlot : maDevSlots)
+        {
+            entry = devSlot.load(std::memory_order_acquire);
+
+            if (entry == cNoDevSlot)
+            {
+                break;
+            }
+
+            if ((entry >> 32) == devAddr)
+            {
+                return (uint32)entry;
+            }
+        }
+
+        uint32 slot = BoardRegStats::getInstance().AddDevice(mBus, devAddr, mName);
+
+        // Cache is a hint; when full, later devices go through AddDevice
+        uint64 newEntry = ((uint64)devAddr << 32) | slot;
+
+        for (auto& devSlot : maDevSlots)
+        {
+            uint64 expected = cNoDevSlot;
+
+            if (devSlot.compare_exchange_strong(expected, newEntry, std::memory_order_acq_rel) ||
+                ((expected >> 32) == devAddr))
+            {
+                break;
+            }
+        }
+
+        return slot;
+    }
+
+    static const uint32 cNumDevSlots = 8;
+
+    static const uint64 cNoDevSlot = ~0ULL;
+
+    std::shared_ptr<T> mspIf;
+
+    RegBusType mBus;
+
+    std::string mName;
+
+    // Moves with SetDevAddr under the bus grant
+    mutable std::atomic<uint32> mSlot;
+
+    // (devAddr << 32) | slot of the devices selected through this handle
+    mutable std::atomic<uint64> maDevSlots[cNumDevSlots];
+};
+
+template<typename T>
+const uint32 RegIfProbe<T>::cNumDevSlots;
+
+template<typename T>
+const uint64 RegIfProbe<T>::cNoDevSlot;
+
+#undef REG_PROBE_FWD
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_PROBE_H_ */
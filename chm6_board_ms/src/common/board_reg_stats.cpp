@@ -0,0 +1,311 @@
+/*
+ * board_reg_stats.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <algorithm>
+#include <boost/format.hpp>
+
+#include "board_reg_stats.h"
+
+const uint32 BoardRegStats::cMaxDevices;
+const uint32 BoardRegStats::cNumHistBuckets;
+const uint32 BoardRegStats::cInvalidSlot;
+
+static thread_local RegCallerType tRegCaller = REG_CALLER_OTHER;
+
+BoardRegStats& BoardRegStats::getInstance()
+{
+    static BoardRegStats theInstance;
+    return theInstance;
+}
+
+BoardRegStats::BoardRegStats()
+    : mNumDevs(0)
+{
+    Reset();
+}
+
+uint32 BoardRegStats::AddDevice(RegBusType bus, uint32 devAddr, const std::string& name)
+{
+    // Published slots never change; look them up without the lock
+    uint32 numDevs = mNumDevs.load(std::memory_order_acquire);
+
+    for (uint32 i = 0; i < numDevs; i++)
+    {
+        if ((maDevs[i].mBus == bus) && (maDevs[i].mDevAddr == devAddr) && (maDevs[i].mName == name))
+        {
+            return i;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(mAddLock);
+
+    // Recheck slots added since the unlocked scan
+    uint32 numChecked = numDevs;
+
+    numDevs = mNumDevs.load(std::memory_order_relaxed);
+
+    for (uint32 i = numChecked; i < numDevs; i++)
+    {
+        if ((maDevs[i].mBus == bus) && (maDevs[i].mDevAddr == devAddr) && (maDevs[i].mName == name))
+        {
+            return i;
+        }
+    }
+
+    if (numDevs >= cMaxDevices)
+    {
+        return cInvalidSlot;
+    }
+
+    maDevs[numDevs].mBus     = bus;
+    maDevs[numDevs].mDevAddr = devAddr;
+    maDevs[numDevs].mName    = name;
+
+    mNumDevs.store(numDevs + 1, std::memory_order_release);
+
+    return numDevs;
+}
+
+void BoardRegStats::Record(uint32 slot, RegOpType op, uint64 latencyNs, bool isException)
+{
+    if ((slot >= cMaxDevices) || (op >= NUM_REG_OPS))
+    {
+        return;
+    }
+
+    DevStats& dev = maDevs[slot];
+
+    RegCallerType caller = tRegCaller;
+
+    dev.maNumOps[op].fetch_add(1, std::memory_order_relaxed);
+    dev.mTotalNs.fetch_add(latencyNs, std::memory_order_relaxed);
+    dev.maHist[LatencyToBucket(latencyNs)].fetch_add(1, std::memory_order_relaxed);
+    dev.maCallerOps[caller].fetch_add(1, std::memory_order_relaxed);
+    dev.maCallerNs[caller].fetch_add(latencyNs, std::memory_order_relaxed);
+
+    if (isException)
+    {
+        dev.mNumExceptions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64 maxNs = dev.mMaxNs.load(std::memory_order_relaxed);
+
+    while ((latencyNs > maxNs) &&
+           !dev.mMaxNs.compare_exchange_weak(maxNs, latencyNs, std::memory_order_relaxed))
+    {
+    }
+}
+
+void BoardRegStats::Reset()
+{
+    for (auto& dev : maDevs)
+    {
+        for (auto& numOps : dev.maNumOps)
+        {
+            numOps = 0;
+        }
+
+        for (auto& hist : dev.maHist)
+        {
+            hist = 0;
+        }
+
+        for (uint32 i = 0; i < NUM_REG_CALLERS; i++)
+        {
+            dev.maCallerOps[i] = 0;
+            dev.maCallerNs[i]  = 0;
+        }
+
+        dev.mNumExceptions = 0;
+        dev.mTotalNs       = 0;
+        dev.mMaxNs         = 0;
+    }
+}
+
+RegCallerType BoardRegStats::GetCaller()
+{
+    return tRegCaller;
+}
+
+void BoardRegStats::SetCaller(RegCallerType caller)
+{
+    tRegCaller = caller;
+}
+
+uint32 BoardRegStats::LatencyToBucket(uint64 latencyNs)
+{
+    uint64 latencyUs = latencyNs / 1000;
+
+    if (latencyUs == 0)
+    {
+        return 0;
+    }
+
+    uint32 bucket = 64 - __builtin_clzll(latencyUs);
+
+    return std::min(bucket, cNumHistBuckets - 1);
+}
+
+std::string BoardRegStats::BucketToStr(uint32 bucket)
+{
+    if (bucket == 0)
+    {
+        return std::string("<1us");
+    }
+
+    if (bucket == cNumHistBuckets - 1)
+    {
+        return ">=" + std::to_string(1ULL << (bucket - 1)) + "us";
+    }
+
+    return "<" + std::to_string(1ULL << bucket) + "us";
+}
+
+void BoardRegStats::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardRegStats.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    uint32 numDevs = mNumDevs.load(std::memory_order_acquire);
+
+    os << boost::format("%-8s : %-28s : %6s : %10s : %10s : %6s : %10s : %10s : %10s")
+          % "Bus" % "Device" % "Addr" % "Reads" % "Writes" % "Excps" % "Avg(us)" % "Max(us)" % "Total(ms)"
+       << std::endl;
+
+    for (uint32 i = 0; i < numDevs; i++)
+    {
+        const DevStats& dev = maDevs[i];
+
+        uint64 numOps  = dev.maNumOps[REG_OP_READ] + dev.maNumOps[REG_OP_WRITE];
+        uint64 totalNs = dev.mTotalNs;
+
+        if (numOps == 0)
+        {
+            continue;
+        }
+
+        os << boost::format("%-8s : %-28s : 0x%04x : %10d : %10d : %6d : %10.1f : %10.1f : %10.1f")
+              % BusToStr(dev.mBus)
+              % dev.mName
+              % dev.mDevAddr
+              % dev.maNumOps[REG_OP_READ].load()
+              % dev.maNumOps[REG_OP_WRITE].load()
+              % dev.mNumExceptions.load()
+              % (totalNs / 1e3 / numOps)
+              % (dev.mMaxNs / 1e3)
+              % (totalNs / 1e6) << std::endl;
+
+        os << "    Callers:";
+        for (uint32 c = 0; c < NUM_REG_CALLERS; c++)
+        {
+            if (dev.maCallerOps[c])
+            {
+                os << " " << CallerToStr(RegCallerType(c)) << "=" << dev.maCallerOps[c]
+                   << "/" << boost::format("%.1f") % (dev.maCallerNs[c] / 1e6) << "ms";
+            }
+        }
+        os << std::endl;
+
+        os << "    Latency:";
+        for (uint32 b = 0; b < cNumHistBuckets; b++)
+        {
+            if (dev.maHist[b])
+            {
+                os << " " << BucketToStr(b) << "=" << dev.maHist[b];
+            }
+        }
+        os << std::endl;
+    }
+}
+
+void BoardRegStats::DumpJson(std::ostream& os)
+{
+    uint32 numDevs = mNumDevs.load(std::memory_order_acquire);
+
+    os << "{\"hist_bucket_us\":[0";
+    for (uint32 b = 1; b < cNumHistBuckets; b++)
+    {
+        os << "," << (1ULL << (b - 1));
+    }
+    os << "],\"devices\":[";
+
+    for (uint32 i = 0; i < numDevs; i++)
+    {
+        const DevStats& dev = maDevs[i];
+
+        os << (i ? "," : "")
+           << "{\"bus\":\"" << BusToStr(dev.mBus) << "\""
+           << ",\"name\":\"" << dev.mName << "\""
+           << ",\"addr\":" << dev.mDevAddr
+           << ",\"reads\":" << dev.maNumOps[REG_OP_READ]
+           << ",\"writes\":" << dev.maNumOps[REG_OP_WRITE]
+           << ",\"exceptions\":" << dev.mNumExceptions
+           << ",\"total_ns\":" << dev.mTotalNs
+           << ",\"max_ns\":" << dev.mMaxNs;
+
+        os << ",\"hist\":[";
+        for (uint32 b = 0; b < cNumHistBuckets; b++)
+        {
+            os << (b ? "," : "") << dev.maHist[b];
+        }
+        os << "]";
+
+        os << ",\"callers\":{";
+        for (uint32 c = 0; c < NUM_REG_CALLERS; c++)
+        {
+            os << (c ? "," : "") << "\"" << CallerToStr(RegCallerType(c)) << "\":"
+               << "{\"ops\":" << dev.maCallerOps[c] << ",\"ns\":" << dev.maCallerNs[c] << "}";
+        }
+        os << "}}";
+    }
+
+    os << "]}" << std::endl;
+}
+
+std::string BoardRegStats::BusToStr(RegBusType bus)
+{
+    switch (bus)
+    {
+        case REG_BUS_FPGA:
+            return std::string("FPGA");
+        case REG_BUS_PL_I2C0:
+            return std::string("PL_I2C0");
+        case REG_BUS_PL_I2C1:
+            return std::string("PL_I2C1");
+        case REG_BUS_PL_I2C2:
+            return std::string("PL_I2C2");
+        case REG_BUS_PL_I2C3:
+            return std::string("PL_I2C3");
+        case REG_BUS_PL_I2C4:
+            return std::string("PL_I2C4");
+        case REG_BUS_PS_I2C0:
+            return std::string("PS_I2C0");
+        case REG_BUS_MDIO:
+            return std::string("MDIO");
+        default:
+            return std::string("Unknown");
+    }
+}
+
+std::string BoardRegStats::CallerToStr(RegCallerType caller)
+{
+    switch (caller)
+    {
+        case REG_CALLER_OTHER:
+            return std::string("other");
+        case REG_CALLER_FAULT_POLL:
+            return std::string("fault_poll");
+        case REG_CALLER_PM:
+            return std::string("pm");
+        case REG_CALLER_LED:
+            return std::string("led");
+        case REG_CALLER_CLI:
+            return std::string("cli");
+        case REG_CALLER_INIT:
+            return std::string("init");
+        default:
+            return std::string("unknown");
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * board_reg_stats.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_STATS_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_STATS_H_
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <exception>
+
+#include "types.h"
+
+typedef enum RegBusType
+{
+    REG_BUS_FPGA = 0,      // PL and misc register space
+    REG_BUS_PL_I2C0,       // Bottom mezz
+    REG_BUS_PL_I2C1,       // Top mezz
+    REG_BUS_PL_I2C2,       // Bottom mezz
+    REG_BUS_PL_I2C3,       // Top mezz
+    REG_BUS_PL_I2C4,       // SKICK
+    REG_BUS_PS_I2C0,       // Host ADM1066
+    REG_BUS_MDIO,          // Gearboxes
+    NUM_REG_BUSES
+} RegBusType;
+
+// Who drove an access; set per thread with RegCallerScope
+typedef enum RegCallerType
+{
+    REG_CALLER_OTHER = 0,
+    REG_CALLER_FAULT_POLL,
+    REG_CALLER_PM,
+    REG_CALLER_LED,
+    REG_CALLER_CLI,
+    REG_CALLER_INIT,
+    NUM_REG_CALLERS
+} RegCallerType;
+
+typedef enum RegOpType
+{
+    REG_OP_READ = 0,
+    REG_OP_WRITE,
+    NUM_REG_OPS
+} RegOpType;
+
+/*
+ * Access counters and latency histograms per bus device. Devices get a
+ * fixed slot on first use; recording is relaxed atomics only, so the
+ * counters cost nothing next to the bus transaction they measure.
+ */
+class BoardRegStats
+{
+public:
+
+    static BoardRegStats& getInstance();
+
+    // Same bus, address and name share a slot; cInvalidSlot when full
+    uint32 AddDevice(RegBusType bus, uint32 devAddr, const std::string& name);
+
+    void Record(uint32 slot, RegOpType op, uint64 latencyNs, bool isException);
+
+    void Dump(std::ostream& os);
+
+    // One JSON object per dump for offline analysis
+    void DumpJson(std::ostream& os);
+
+    void Reset();
+
+    static RegCallerType GetCaller();
+
+    static void SetCaller(RegCallerType caller);
+
+    static std::string BusToStr(RegBusType bus);
+
+    static std::string CallerToStr(RegCallerType caller);
+
+    static const uint32 cMaxDevices = 96;
+
+    // Bucket 0 is < 1 us, bucket n is [2^(n-1), 2^n) us, the last is open ended
+    static const uint32 cNumHistBuckets = 16;
+
+    static const uint32 cInvalidSlot = 0xFFFFFFFF;
+
+private:
+
+    struct DevStats
+    {
+        RegBusType  mBus;
+        uint32      mDevAddr;
+        std::string mName;
+
+        std::atomic<uint64> maNumOps[NUM_REG_OPS];
+        std::atomic<uint64> mNumExceptions;
+        std::atomic<uint64> mTotalNs;
+        std::atomic<uint64> mMaxNs;
+        std::atomic<uint64> maHist[cNumHistBuckets];
+        std::atomic<uint64> maCallerOps[NUM_REG_CALLERS];
+        std::atomic<uint64> maCallerNs[NUM_REG_CALLERS];
+    };
+
+    BoardRegStats();
+
+    ~BoardRegStats() {}
+
+    static uint32 LatencyToBucket(uint64 latencyNs);
+
+    static std::string BucketToStr(uint32 bucket);
+
+    DevStats maDevs[cMaxDevices];
+
+    // Slots below this are fully set up
+    std::atomic<uint32> mNumDevs;
+
+    std::mutex mAddLock;
+};
+
+/*
+ * Tags accesses on this thread with caller for the scope. The outermost
+ * scope wins, so a CLI command that sets an LED counts as CLI.
+ */
+class RegCallerScope
+{
+public:
+
+    explicit RegCallerScope(RegCallerType caller)
+        : mPrevCaller(BoardRegStats::GetCaller())
+    {
+        if (mPrevCaller == REG_CALLER_OTHER)
+        {
+            BoardRegStats::SetCaller(caller);
+        }
+    }
+
+    ~RegCallerScope()
+    {
+        BoardRegStats::SetCaller(mPrevCaller);
+    }
+
+private:
+
+    RegCallerType mPrevCaller;
+};
+
+// Times one access; an exception unwinding through it counts as failed
+class RegAccessTimer
+{
+public:
+
+    RegAccessTimer(uint32 slot, RegOpType op)
+        : mSlot(slot)
+        , mOp(op)
+        , mStart(std::chrono::steady_clock::now())
+    {}
+
+    ~RegAccessTimer()
+    {
+        if (mSlot == BoardRegStats::cInvalidSlot)
+        {
+            return;
+        }
+
+        uint64 latencyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - mStart).count();
+
+        BoardRegStats::getInstance().Record(mSlot, mOp, latencyNs, std::uncaught_exception());
+    }
+
+private:
+
+    uint32 mSlot;
+    RegOpType mOp;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_REG_STATS_H_ */
@@ -0,0 +1,133 @@
+/*
+ * board_trace.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <time.h>
+#include <boost/format.hpp>
+
+#include "board_trace.h"
+
+const uint32 BoardTraceRing::cMaxArgs;
+const uint32 BoardTraceRing::cDefaultNumRecords;
+
+BoardTraceRing::BoardTraceRing(uint32 numRecords)
+    : mNextIdx(0)
+    , mDumpStartIdx(0)
+{
+    uint64 size = 1;
+
+    while (size < numRecords)
+    {
+        size <<= 1;
+    }
+
+    mupSlots.reset(new Slot[size]);
+    mMask = size - 1;
+
+    for (uint64 i = 0; i < size; i++)
+    {
+        mupSlots[i].mSeq.store(0, std::memory_order_relaxed);
+    }
+}
+
+void BoardTraceRing::Write(const char* func, uint32 line, const char* fmt, uint32 numArgs, const uint64* pArgs)
+{
+    uint64 idx = mNextIdx.fetch_add(1, std::memory_order_relaxed);
+
+    Slot& slot = mupSlots[idx & mMask];
+
+    // vDSO clock; no syscall
+    struct timespec mono;
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+
+    uint64 seq = 2 * idx + 1;
+
+    slot.mSeq.store(seq, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.mpFmt.store(fmt, std::memory_order_relaxed);
+    slot.mpFunc.store(func, std::memory_order_relaxed);
+    slot.mLine.store(line, std::memory_order_relaxed);
+    slot.mNumArgs.store(numArgs, std::memory_order_relaxed);
+    slot.mMonoNs.store((uint64)mono.tv_sec * 1000000000ULL + mono.tv_nsec, std::memory_order_relaxed);
+
+    for (uint32 i = 0; i < numArgs; i++)
+    {
+        slot.maArgs[i].store(pArgs[i], std::memory_order_relaxed);
+    }
+
+    slot.mSeq.store(seq + 1, std::memory_order_release);
+}
+
+void BoardTraceRing::Dump(std::ostream& os)
+{
+    uint64 nextIdx  = mNextIdx.load(std::memory_order_acquire);
+    uint64 startIdx = mDumpStartIdx.load(std::memory_order_relaxed);
+    uint64 size     = mMask + 1;
+
+    if (nextIdx > startIdx + size)
+    {
+        startIdx = nextIdx - size;
+    }
+
+    os << "Trace records: " << nextIdx << " Ring size: " << size << std::endl << std::endl;
+
+    for (uint64 idx = startIdx; idx < nextIdx; idx++)
+    {
+        const Slot& slot = mupSlots[idx & mMask];
+
+        uint64 seq = slot.mSeq.load(std::memory_order_acquire);
+
+        // Still being written or already overwritten
+        if (seq != 2 * idx + 2)
+        {
+            continue;
+        }
+
+        const char* fmt     = slot.mpFmt.load(std::memory_order_relaxed);
+        const char* func    = slot.mpFunc.load(std::memory_order_relaxed);
+        uint32      line    = slot.mLine.load(std::memory_order_relaxed);
+        uint32      numArgs = slot.mNumArgs.load(std::memory_order_relaxed);
+        uint64      monoNs  = slot.mMonoNs.load(std::memory_order_relaxed);
+
+        uint64 aArgs[cMaxArgs];
+        for (uint32 i = 0; i < numArgs && i < cMaxArgs; i++)
+        {
+            aArgs[i] = slot.maArgs[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.mSeq.load(std::memory_order_relaxed) != seq)
+        {
+            continue;
+        }
+
+        // Formatting deferred to here
+        std::string text;
+        try
+        {
+            boost::format fmtr(fmt);
+
+            for (uint32 i = 0; i < numArgs && i < cMaxArgs; i++)
+            {
+                fmtr % (sint64)aArgs[i];
+            }
+
+            text = fmtr.str();
+        }
+        catch (boost::io::format_error &e)
+        {
+            text = std::string(fmt) + " <bad trace format>";
+        }
+
+        os << boost::format("%14.6f %s:%d: %s") % (monoNs / 1e9) % func % line % text << std::endl;
+    }
+}
+
+void BoardTraceRing::Reset()
+{
+    mDumpStartIdx.store(mNextIdx.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
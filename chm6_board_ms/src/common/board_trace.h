@@ -0,0 +1,89 @@
+/*
+ * board_trace.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_COMMON_BOARD_TRACE_H_
+#define CHM6_BOARD_MS_SRC_COMMON_BOARD_TRACE_H_
+
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "types.h"
+
+// Records func/line of the call site; fmt must be a string literal
+#define BRD_TRACE(ring, fmt, ...) (ring).Add(__func__, __LINE__, fmt, ##__VA_ARGS__)
+
+/*
+ * Lock free trace for callback and LED paths. A record is a static format
+ * string, its call site, a monotonic timestamp and up to cMaxArgs integer
+ * args; nothing is formatted until Dump. Any number of writers claim slots
+ * with one fetch_add; each slot is a seqlock so Dump skips a slot that is
+ * being written. A writer lapped by a full ring while mid record can tear
+ * that record; Dump drops it rather than print mixed args.
+ */
+class BoardTraceRing
+{
+public:
+
+    static const uint32 cMaxArgs = 4;
+
+    static const uint32 cDefaultNumRecords = 2048;
+
+    // numRecords rounds up to a power of two
+    explicit BoardTraceRing(uint32 numRecords = cDefaultNumRecords);
+
+    ~BoardTraceRing() {}
+
+    template<typename... Args>
+    void Add(const char* func, uint32 line, const char* fmt, Args... args)
+    {
+        static_assert(sizeof...(Args) <= cMaxArgs, "Too many trace args");
+
+        const uint64 aArgs[cMaxArgs] = { ToArg(args)... };
+
+        Write(func, line, fmt, sizeof...(Args), aArgs);
+    }
+
+    void Dump(std::ostream& os);
+
+    // Later dumps start after the current newest record
+    void Reset();
+
+private:
+
+    struct Slot
+    {
+        std::atomic<uint64>      mSeq;  // 2 * index + 1 while writing, + 2 when done
+        std::atomic<const char*> mpFmt;
+        std::atomic<const char*> mpFunc;
+        std::atomic<uint32>      mLine;
+        std::atomic<uint32>      mNumArgs;
+        std::atomic<uint64>      mMonoNs;
+        std::atomic<uint64>      maArgs[cMaxArgs];
+    };
+
+    template<typename T>
+    static uint64 ToArg(T arg)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "Trace args must be integers or enums");
+
+        return static_cast<uint64>(arg);
+    }
+
+    void Write(const char* func, uint32 line, const char* fmt, uint32 numArgs, const uint64* pArgs);
+
+    std::unique_ptr<Slot[]> mupSlots;
+
+    uint64 mMask;
+
+    std::atomic<uint64> mNextIdx;
+
+    std::atomic<uint64> mDumpStartIdx;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_COMMON_BOARD_TRACE_H_ */
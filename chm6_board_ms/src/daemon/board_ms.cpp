@@ -100,6 +100,10 @@ int main()
         }
         sleep(1);
     }
+
+    // Restart and shutdown history must reach flash before exit
+    BoardJournal::getInstance().Flush(true);
+
     _exit(global_exit_code);
 //    return global_exit_code;
 }
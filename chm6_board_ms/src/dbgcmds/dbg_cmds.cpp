@@ -34,6 +34,9 @@ int DbgCmds(BoardDriver& driver
             , boardAda::BoardAdapter& adapter
             , BoardManager& manager)
 {
+    // Everything the CLI thread touches counts as CLI in the register stats
+    RegCallerScope callerScope(REG_CALLER_CLI);
+
 #if BOOST_VERSION < 106600
     boost::asio::io_service ios;
 #else
@@ -29,14 +29,16 @@ void DriverCmds::DumpStatus(std::ostream& out, std::string instr)
     if (instr == std::string("tmp")
      || instr == std::string("tmp_all")
      || instr == std::string("led")
-     || instr == std::string("sac"))
+     || instr == std::string("sac")
+     || instr == std::string("i2c_sched")
+     || instr == std::string("ready_wait"))
     {
         driver.DumpStatus(out, instr);
     }
     else
     {
         out << "Not supported command. Valid commands:" << std::endl
-            << "\ttmp\n\ttmp_all\n\tled\n\tsac"<< std::endl;
+            << "\ttmp\n\ttmp_all\n\tled\n\tsac\n\ti2c_sched\n\tready_wait"<< std::endl;
     }
 }
 
@@ -45,6 +47,21 @@ void DriverCmds::ResetLog(std::ostream& out)
     driver.ResetLog(out);
 }
 
+void DriverCmds::DumpRegStats(std::ostream& out, std::string instr)
+{
+    if (instr == std::string("table")
+     || instr == std::string("json")
+     || instr == std::string("reset"))
+    {
+        driver.DumpRegStats(out, instr);
+    }
+    else
+    {
+        out << "Not supported command. Valid commands:" << std::endl
+            << "\ttable\n\tjson\n\treset"<< std::endl;
+    }
+}
+
 /*
  * CLI commands to access RegIf
  */
@@ -312,6 +329,11 @@ void DriverCmds::WriteToMfgEeprom(std::ostream& out)
     driver.WriteToMfgEeprom(out);
 }
 
+void DriverCmds::ProgramMfgEeprom(std::ostream& out)
+{
+    driver.ProgramMfgEeprom(out);
+}
+
 void DriverCmds::DumpEepromBin(std::ostream& out)
 {
     driver.DumpEepromBin(out);
@@ -755,6 +777,7 @@ void DriverCmds::DumpHostAdm1066Eeprom(std::ostream& out)
 boost::function< void (DriverCmds*, std::ostream&) > cmdDumpDriverLog = &DriverCmds::DumpLog;
 boost::function< void (DriverCmds*, std::ostream&, std::string) > cmdDumpDriverStatus = &DriverCmds::DumpStatus;
 boost::function< void (DriverCmds*, std::ostream&) > cmdResetDriverLog = &DriverCmds::ResetLog;
+boost::function< void (DriverCmds*, std::ostream&, std::string) > cmdDumpRegStats = &DriverCmds::DumpRegStats;
 
 // regif commands
 boost::function< void (DriverCmds*, std::ostream&, std::string) > cmdFpgaRead = &DriverCmds::FpgaRead;
@@ -781,6 +804,7 @@ boost::function< void (DriverCmds*, std::ostream&, std::string) > cmdImportMfgEe
 boost::function< void (DriverCmds*, std::ostream&, std::string) > cmdExportMfgEepromToBinFile = &DriverCmds::ExportMfgEepromToBinFile;
 boost::function< void (DriverCmds*, std::ostream&) > cmdReadFromMfgEeprom = &DriverCmds::ReadFromMfgEeprom;
 boost::function< void (DriverCmds*, std::ostream&) > cmdWriteToMfgEeprom = &DriverCmds::WriteToMfgEeprom;
+boost::function< void (DriverCmds*, std::ostream&) > cmdProgramMfgEeprom = &DriverCmds::ProgramMfgEeprom;
 boost::function< void (DriverCmds*, std::ostream&) > cmdDumpEepromBin = &DriverCmds::DumpEepromBin;
 boost::function< void (DriverCmds*, std::ostream&, int) > cmdDumpEepromFields = &DriverCmds::DumpEepromFields;
 boost::function< void (DriverCmds*, std::ostream&) > cmdDumpEepromBinBufSrcName = &DriverCmds::DumpEepromBinBufSrcName;
@@ -832,13 +856,25 @@ void InsertDriverCmds(unique_ptr< Menu > & driverMenu, DriverCmds& driverCmds)
             "\t\"tmp\": dump temperatures\n"
             "\t\"tmp_all\": dump all temperature related data\n"
             "\t\"led\": dump all LED states\n"
-            "\t\"sac\": dump SAC bus states\n",
+            "\t\"sac\": dump SAC bus states\n"
+            "\t\"i2c_sched\": dump I2C transaction waits per bus and class\n"
+            "\t\"ready_wait\": dump bring-up readiness waits\n",
             {"command"} );
 
     driverMenu -> Insert(
             "resetlog",
             [&](std::ostream& out){ cmdResetDriverLog(&driverCmds, out); },
             "Reset driver log" );
+
+    driverMenu -> Insert(
+            "reg_stats",
+            [&](std::ostream& out, std::string instr){ cmdDumpRegStats(&driverCmds, out, instr); },
+            "Dump register access counts and latency per bus device\n"
+            "\tValid commands:\n"
+            "\t\"table\": dump per device table with caller split and histogram\n"
+            "\t\"json\": dump everything as one JSON object\n"
+            "\t\"reset\": clear all counters, I2C scheduler included\n",
+            {"command"} );
 }
 
 void InsertRegIfCmds(unique_ptr< Menu > & subMenu_regif, DriverCmds& driverCmds)
@@ -1027,6 +1063,14 @@ void InsertMfgEepromCmds(unique_ptr< Menu > & subMenu_eeprom, DriverCmds& driver
             },
             "write from buffer into EEPROM" );
 
+    subMenu_eeprom -> Insert(
+            "program",
+            [&](std::ostream& out)
+            {
+                cmdProgramMfgEeprom(&driverCmds, out);
+            },
+            "write only differing bytes of buffer into EEPROM, verified" );
+
     subMenu_eeprom -> Insert(
             "dump_bin",
             [&](std::ostream& out)
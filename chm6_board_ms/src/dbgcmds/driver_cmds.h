@@ -24,6 +24,8 @@ public:
 
     void ResetLog(std::ostream& out);
 
+    void DumpRegStats(std::ostream& out, std::string instr);
+
     /*
      * CLI commands to access RegIf
      */
@@ -108,6 +110,8 @@ public:
 
     void WriteToMfgEeprom(std::ostream& out);
 
+    void ProgramMfgEeprom(std::ostream& out);
+
     void DumpEepromBin(std::ostream& out);
 
     void DumpEepromFields(std::ostream& out, int level=0);
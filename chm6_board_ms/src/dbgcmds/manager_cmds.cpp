@@ -56,6 +56,21 @@ void ManagerCmds::DumpBoardPm(std::ostream& out)
     manager.DumpBoardPm(out);
 }
 
+void ManagerCmds::DumpJournal(std::ostream& out, std::string ring, uint32 numRecs)
+{
+    manager.DumpJournal(out, ring, numRecs);
+}
+
+void ManagerCmds::DumpBootProf(std::ostream& out, uint32 numBoots)
+{
+    manager.DumpBootProf(out, numBoots);
+}
+
+void ManagerCmds::DumpInitFprint(std::ostream& out)
+{
+    manager.DumpInitFprint(out);
+}
+
 void ManagerCmds::SetRestartWarm(std::ostream& out)
 {
     manager.SetRestartWarm(out);
@@ -76,6 +91,11 @@ void ManagerCmds::DumpSwVersion(std::ostream& out)
     manager.DumpSwVersion(out);
 }
 
+void ManagerCmds::SetDeltaPublish(std::ostream& out, bool enable)
+{
+    manager.SetDeltaPublish(out, enable);
+}
+
 //////////////////////////////////////////////////////////////
 
 boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpManagerLog = &ManagerCmds::DumpLog;
@@ -85,10 +105,14 @@ boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpBoardConfig = &Mana
 boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpBoardState = &ManagerCmds::DumpBoardState;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpBoardFault = &ManagerCmds::DumpBoardFault;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpBoardPm = &ManagerCmds::DumpBoardPm;
+boost::function< void (ManagerCmds*, std::ostream&, std::string, uint32) > cmdDumpJournal = &ManagerCmds::DumpJournal;
+boost::function< void (ManagerCmds*, std::ostream&, uint32) > cmdDumpBootProf = &ManagerCmds::DumpBootProf;
+boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpInitFprint = &ManagerCmds::DumpInitFprint;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdSetRestartWarm = &ManagerCmds::SetRestartWarm;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdSetRestartCold = &ManagerCmds::SetRestartCold;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdSetGracefulShutdown = &ManagerCmds::SetGracefulShutdown;
 boost::function< void (ManagerCmds*, std::ostream&) > cmdDumpSwVersion = &ManagerCmds::DumpSwVersion;
+boost::function< void (ManagerCmds*, std::ostream&, bool) > cmdSetDeltaPublish = &ManagerCmds::SetDeltaPublish;
 
 void InsertManagerCmds(unique_ptr< Menu > & managerMenu, ManagerCmds& managerCmds)
 {
@@ -128,6 +152,23 @@ void InsertManagerCmds(unique_ptr< Menu > & managerMenu, ManagerCmds& managerCmd
             [&](std::ostream& out){ cmdDumpBoardPm(&managerCmds, out); },
             "Dump Pms in manager cache" );
 
+    managerMenu -> Insert(
+            "journal",
+            [&](std::ostream& out, std::string ring, int numRecs){ cmdDumpJournal(&managerCmds, out, ring, numRecs); },
+            "Decode persistent journal, kept across restarts",
+            {"ring: event|pm", "number of latest records"} );
+
+    managerMenu -> Insert(
+            "boot_prof",
+            [&](std::ostream& out, int numBoots){ cmdDumpBootProf(&managerCmds, out, numBoots); },
+            "Dump board init phase timing, compared with earlier boots",
+            {"number of earlier boots to compare"} );
+
+    managerMenu -> Insert(
+            "init_fprint",
+            [&](std::ostream& out){ cmdDumpInitFprint(&managerCmds, out); },
+            "Dump hardware init fingerprint used by warm boot" );
+
     managerMenu -> Insert(
             "restart_warm",
             [&](std::ostream& out){ cmdSetRestartWarm(&managerCmds, out); },
@@ -147,4 +188,10 @@ void InsertManagerCmds(unique_ptr< Menu > & managerMenu, ManagerCmds& managerCmd
             "sw_version",
             [&](std::ostream& out){ cmdDumpSwVersion(&managerCmds, out); },
             "Dump SW Version" );
+
+    managerMenu -> Insert(
+            "delta_publish",
+            [&](std::ostream& out, bool enable){ cmdSetDeltaPublish(&managerCmds, out, enable); },
+            "Publish board state/fault changes only\n"
+                "\t\tenable - true: delta only; false: full cached object. Stats in 'status publish'" );
 }
@@ -35,6 +35,12 @@ public:
 
     void DumpBoardPm(std::ostream& out);
 
+    void DumpJournal(std::ostream& out, std::string ring, uint32 numRecs);
+
+    void DumpBootProf(std::ostream& out, uint32 numBoots);
+
+    void DumpInitFprint(std::ostream& out);
+
     /*
      * CLI commands to restart
      */
@@ -46,6 +52,8 @@ public:
 
     void DumpSwVersion(std::ostream& out);
 
+    void SetDeltaPublish(std::ostream& out, bool enable);
+
 private:
     BoardManager& manager;
 };
@@ -188,6 +188,11 @@ void SimAdapterCmds::SetLedLampTest(std::ostream &os, int doTest)
     mSimAdapter.SetLedLampTest(os, (bool)doTest);
 }
 
+void SimAdapterCmds::InjectFaultEvent(std::ostream &os, int eventGroups)
+{
+    mSimAdapter.InjectFaultEvent(os, (uint32)eventGroups);
+}
+
 ////////////////////////////////////////////////////////////
 
 boost::function< void (SimAdapterCmds*, std::ostream&, int) > cmdSetEqptState = &SimAdapterCmds::SetEqptState;
@@ -199,6 +204,7 @@ boost::function< void (SimAdapterCmds*, std::ostream&, int) > cmdSetActiveLedSta
 boost::function< void (SimAdapterCmds*, std::ostream&, int, int, int) > cmdSetPortLedState = &SimAdapterCmds::SetPortLedState;
 boost::function< void (SimAdapterCmds*, std::ostream&, int, int, int) > cmdSetLineLedState = &SimAdapterCmds::SetLineLedState;
 boost::function< void (SimAdapterCmds*, std::ostream&, int) > cmdSetLedLampTest = &SimAdapterCmds::SetLedLampTest;
+boost::function< void (SimAdapterCmds*, std::ostream&, int) > cmdInjectFaultEvent = &SimAdapterCmds::InjectFaultEvent;
 
 void InsertSimAdapterCmds(unique_ptr< Menu > & adapterMenu, SimAdapterCmds& adapterCmds)
 {
@@ -316,5 +322,11 @@ void InsertSimAdapterCmds(unique_ptr< Menu > & adapterMenu, SimAdapterCmds& adap
             [&](std::ostream& out, int doTest){ cmdSetLedLampTest(&adapterCmds, out, doTest); },
             "Enable or disable LED lamp test",
             {"doTest(0: disable; >=1: enable)"} );
+
+    adapterMenu -> Insert(
+            "inject_fault_event",
+            [&](std::ostream& out, int eventGroups){ cmdInjectFaultEvent(&adapterCmds, out, eventGroups); },
+            "Inject fault event as the fault interrupt would",
+            {"eventGroups(1: host digital; 2: polled; 3: all)"} );
 }
 
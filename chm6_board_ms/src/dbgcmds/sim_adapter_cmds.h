@@ -35,6 +35,8 @@ public:
 
     void SetLedLampTest(std::ostream &os, int doTest);
 
+    void InjectFaultEvent(std::ostream &os, int eventGroups);
+
 private:
     simBoardAda::SimBoardAdapterIf& mSimAdapter;
 };
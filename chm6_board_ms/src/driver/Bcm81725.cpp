@@ -1,4 +1,5 @@
 #include "epdm.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <iostream>
@@ -6,7 +7,12 @@
 #include <unistd.h>
 #include <vector>
 #include <cassert>
+#include <fstream>
+#include <atomic>
 #include "Bcm81725.h"
+#include "board_reg_stats.h"
+#include "board_ready_wait.h"
+#include "board_init_fprint.h"
 
 
 namespace gearbox {
@@ -34,9 +40,51 @@ const uint32 cAdr2 = 0x5200c7f8; // ACR 2
 const uint16 cDat1 = 0x817a;     // ACR 1 data
 const uint16 cDat2 = 0x7e85;     // ACR 2 data
 
+// After core reset: settle, first poll, max poll, deadline; all ms
+const ReadyWaitSpec cCoreResetWait = { "Bcm81725CoreReset", 100, 10, 200, 1000 };
+
+// PMA/PMD device identifier 1, answers once the core is out of reset
+const unsigned int cPmaDevId1Reg = 0x10002;
+
+// Bundled image info; must outlive a cold reset, Bcm81725FwImageFile env overrides
+const char* cFwImageInfoFile       = "/var/log/chm6_bcm81725_fw_image";
+const char* cFwImageInfoFileEnvStr = "Bcm81725FwImageFile";
+
+// Image info only holds for the build that learned it; an upgrade starts clean
+static unsigned int fwImageBuildKey()
+{
+    return BoardInitFprint::Hash(std::string(__DATE__ " " __TIME__));
+}
+
+static std::string fwImageInfoFile()
+{
+    const char* pEnvStr = getenv(cFwImageInfoFileEnvStr);
+
+    return (pEnvStr ? pEnvStr : cFwImageInfoFile);
+}
+
 
 static FpgaMdioIf* mdioIfPtr;
 
+// Stats slot + 1 per bus and phy address; 0 until first access
+static std::atomic<uint32> mdioStatsSlot[cNumMz][0x20];
+
+static uint32 mdioStatsSlotGet(uint8_t busSel, unsigned int mdioAddr)
+{
+    std::atomic<uint32>& slot = mdioStatsSlot[busSel % cNumMz][mdioAddr & 0x1F];
+
+    uint32 slotPlusOne = slot.load(std::memory_order_relaxed);
+
+    if (slotPlusOne == 0)
+    {
+        slotPlusOne = BoardRegStats::getInstance().AddDevice(REG_BUS_MDIO,
+                                                             (busSel << 8) | (mdioAddr & 0x1F),
+                                                             "Bcm81725") + 1;
+        slot.store(slotPlusOne, std::memory_order_relaxed);
+    }
+
+    return slotPlusOne - 1;
+}
 
 
 int mdio_write(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned int data) 
@@ -58,6 +106,7 @@ int mdio_write(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned
 
     try 
     {
+        RegAccessTimer timer(mdioStatsSlotGet(busSel, mdioAddr), REG_OP_WRITE);
         mdioIfPtr->Write16(busSel, mdioAddr, regAddr, data);
     }
     catch ( ... ) 
@@ -69,15 +118,10 @@ int mdio_write(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned
     return 0;
 }
 
-int mdio_read(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned int *data) 
+// mdio_read without the console report; for polls that expect failures
+static int mdio_read_quiet(unsigned int bus, unsigned int mdioAddr, unsigned int regAddr, unsigned int *data)
 {
-    if (!user || !data) 
-    {
-        std::cout << " mdio_read invalid parameter!!!" << endl;
-        return -1; 
-    }
-
-    uint8_t busSel = (uint8_t)(*((unsigned int*)user));
+    uint8_t busSel = (uint8_t)bus;
 
     if ( (busSel == cTopMz) || (mdioAddr >> 4 == 1) )
     {
@@ -86,9 +130,26 @@ int mdio_read(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned
     }
 
     try {
+        RegAccessTimer timer(mdioStatsSlotGet(busSel, mdioAddr), REG_OP_READ);
         *data = static_cast<unsigned int>(mdioIfPtr->Read16(busSel, mdioAddr, regAddr));
-    }    
+    }
     catch ( ... ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int mdio_read(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned int *data) 
+{
+    if (!user || !data) 
+    {
+        std::cout << " mdio_read invalid parameter!!!" << endl;
+        return -1; 
+    }
+
+    if (mdio_read_quiet(*((unsigned int*)user), mdioAddr, regAddr, data) != 0)
+    {
         std::cout << " mdio_read failed!!!" << endl;
         return -1;
     }
@@ -97,10 +158,20 @@ int mdio_read(void *user, unsigned int mdioAddr, unsigned int regAddr, unsigned
 }
 
 Bcm81725::Bcm81725() : myLogPtr(new SimpleLog::Log(2000)), myMilleniObPtr("milleniob") 
+    , myIsFwImageKnown(false), myFwImageVer(0), myFwImageCrc(0)
 {
     std::ostringstream  log;
     log << " Bcm81725::Bcm81725 ";
 
+    for (unsigned int bus = 0; bus < cNumMdioBus; bus++)
+    {
+        myFwLoadPath[bus] = FW_LOAD_NONE;
+        myNumFwCoresLoaded[bus] = 0;
+        myIsPlpInit[bus] = false;
+    }
+
+    readFwImageInfo();
+
     // todo: switch to factory for creation
 	myFpgaRAPtr = new FpgaRegIf(FPGA_BASE_ADDR, FPGA_SIZE);
 
@@ -171,7 +242,7 @@ int Bcm81725::warmInit(const Bcm81725Lane& param)
         return rv;
     }
 
-    sleep(1); /* After Hard reset sleep */
+    waitCoresReady(param.bus, &param.mdioAddr, 1); /* After Hard reset */
     rv |= bcm_plp_init_fw_bcast(myMilleniObPtr, phyInfo, mdio_read, mdio_write,
             &fwLoadType, bcmpmFirmwareBroadcastEnable);
     if (rv != 0) {
@@ -295,8 +366,8 @@ int Bcm81725::loadFirmware(const unsigned int & bus) {
     log << " Bcm81725::loadFirmware ";
 
     int rv = 0;
-    unsigned int *phyIdx = (unsigned int *)cPhyIdx0;
-    unsigned int numPhyIdx = cNumPhyIdx0;
+    unsigned int *allPhyIdx = (unsigned int *)cPhyIdx0;
+    unsigned int numAllPhyIdx = cNumPhyIdx0;
 
     unsigned int phyId = 0;
     unsigned int fwVer = 0, fwCrc = 0;
@@ -308,10 +379,48 @@ int Bcm81725::loadFirmware(const unsigned int & bus) {
 
     if (bus == cTopMz)
     {
-        phyIdx = (unsigned int *)cPhyIdx1;
-        numPhyIdx = cNumPhyIdx1;
+        allPhyIdx = (unsigned int *)cPhyIdx1;
+        numAllPhyIdx = cNumPhyIdx1;
     }
 
+    bool isFwImageKnown;
+    {
+        std::lock_guard<std::mutex> lck(myFwImageMtx);
+        isFwImageKnown = myIsFwImageKnown;
+    }
+
+    // Firmware info is only readable once the PLP is set up in this process;
+    // if the skip init cannot bring the cores up they all get the full load
+    bool isPlpInit = isFwImageKnown && (initFwSkip(bus, allPhyIdx, numAllPhyIdx) == 0);
+
+    // Download only to cores not already running the bundled image
+    std::vector<unsigned int> vLoadPhyIdx;
+    for (phyId = 0; phyId < numAllPhyIdx; ++phyId)
+    {
+        if (!isPlpInit || !isFwCurrent(bus, allPhyIdx[phyId]))
+        {
+            vLoadPhyIdx.push_back(allPhyIdx[phyId]);
+        }
+    }
+
+    myNumFwCoresLoaded[bus] = vLoadPhyIdx.size();
+
+    if (vLoadPhyIdx.empty())
+    {
+        myFwLoadPath[bus] = FW_LOAD_SKIPPED;
+
+        std::cout << " mz=" << bus << " firmware current, download skipped" << endl;
+        log << " mz=" << bus << " firmware current, download skipped" << endl;
+        addLog(__func__, __LINE__, log.str());
+        return 0;
+    }
+
+    // Cleared below once the download and version read back pass
+    myFwLoadPath[bus] = FW_LOAD_FAILED;
+
+    unsigned int *phyIdx = vLoadPhyIdx.data();
+    unsigned int numPhyIdx = vLoadPhyIdx.size();
+
 #if 0
     for (phyId = 0; phyId < sizeof(phyIdx)/sizeof(phyIdx[0]); ++phyId)
     {
@@ -363,7 +472,7 @@ int Bcm81725::loadFirmware(const unsigned int & bus) {
              << " bcmpmFirmwareBroadcastFirmwareCoreReset API success" << endl;
         addLog(__func__, __LINE__, log.str());
     }
-    sleep(1); /* After Hard reset sleep */
+    waitCoresReady(bus, phyIdx, numPhyIdx); /* After Hard reset */
 
     /** Step-2: Enable the broadcast for all phy id in mdio bus * */
     for (phyId = 0; phyId < numPhyIdx; ++phyId) {
@@ -474,16 +583,263 @@ int Bcm81725::loadFirmware(const unsigned int & bus) {
             << " fwVer = " << fwVer
             << " fwCrc = " << fwCrc << std::dec << endl;
         addLog(__func__, __LINE__, log.str());
+
+        if (phyId == 0)
+        {
+            saveFwImageInfo(fwVer, fwCrc);
+        }
     }
 
+    myFwLoadPath[bus] = (numPhyIdx == numAllPhyIdx) ? FW_LOAD_FULL : FW_LOAD_PARTIAL;
+    myIsPlpInit[bus] = true;
+
+    log << " mz=" << bus << " firmware " << fwLoadPathToStr(myFwLoadPath[bus])
+        << " cores loaded: " << numPhyIdx << endl;
+    addLog(__func__, __LINE__, log.str());
+
     return rv;
 }
 
+/*
+ * warmInit() sequence over the cores of a bus: the skip method installs
+ * phy contexts and MDIO accessors and verifies the running firmware
+ * without downloading. Needed before any other PLP call in this process
+ * on cores whose download is skipped.
+ */
+int Bcm81725::initFwSkip(const unsigned int &bus, const unsigned int *phyIdx, unsigned int numPhyIdx)
+{
+    std::ostringstream  log;
+    int rv = 0;
+
+    bcm_plp_access_t  phyInfo;
+    memset(&phyInfo, 0, sizeof(bcm_plp_access_t));
+    phyInfo.platform_ctxt = (void*)(&bus);
+
+    bcm_plp_firmware_load_type_t fwLoadType;
+    memset(&fwLoadType, 0, sizeof(bcm_plp_firmware_load_type_t));
+    fwLoadType.firmware_load_method = bcmpmFirmwareLoadMethodInternal;
+    fwLoadType.force_load_method = bcmpmFirmwareLoadSkip;
+
+    const decltype(bcmpmFirmwareBroadcastEnd) steps[] = { bcmpmFirmwareBroadcastCoreReset,
+                                                          bcmpmFirmwareBroadcastEnable,
+                                                          bcmpmFirmwareBroadcastFirmwareExecute,
+                                                          bcmpmFirmwareBroadcastFirmwareVerify,
+                                                          bcmpmFirmwareBroadcastEnd };
+
+    for (unsigned int step = 0; step < sizeof(steps)/sizeof(steps[0]); ++step)
+    {
+        // Execute is broadcast; issued on the first core only, as in loadFirmware
+        unsigned int numStepPhyIdx = (steps[step] == bcmpmFirmwareBroadcastFirmwareExecute) ? 1 : numPhyIdx;
+
+        for (unsigned int phyId = 0; phyId < numStepPhyIdx; ++phyId)
+        {
+            phyInfo.phy_addr = phyIdx[phyId];
+
+            if ((rv = bcm_plp_init_fw_bcast(myMilleniObPtr, phyInfo, mdio_read, mdio_write,
+                                            &fwLoadType, steps[step])) != 0)
+            {
+                log << " mz=" << bus << " skip init step " << (step + 1) << " phy=" << std::hex << phyIdx[phyId]
+                    << std::dec << " failed rv: " << rv << PrintErrorCode(rv) << endl;
+                addLog(__func__, __LINE__, log.str());
+                return rv;
+            }
+        }
+
+        if (steps[step] == bcmpmFirmwareBroadcastCoreReset)
+        {
+            waitCoresReady(bus, phyIdx, numPhyIdx);
+        }
+    }
+
+    myIsPlpInit[bus] = true;
+
+    log << " mz=" << bus << " skip init done, cores: " << numPhyIdx << endl;
+    addLog(__func__, __LINE__, log.str());
+
+    return 0;
+}
+
+/*
+ * Replaces the fixed 1 s after core reset: returns once every core in
+ * phyIdx answers MDIO with a sane PMA device ID, or at the deadline.
+ */
+int Bcm81725::waitCoresReady(const unsigned int &bus, const unsigned int *phyIdx, unsigned int numPhyIdx)
+{
+    return BoardReadyWait::WaitUntilReady(cCoreResetWait, [&]()
+    {
+        for (unsigned int i = 0; i < numPhyIdx; ++i)
+        {
+            unsigned int devId = 0;
+
+            // Not answering yet is expected here; keep it off the console
+            if ((mdio_read_quiet(bus, phyIdx[i], cPmaDevId1Reg, &devId) != 0) ||
+                (devId == 0) || (devId == 0xFFFF))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    });
+}
+
+int Bcm81725::getFwInfo(const unsigned int &bus, unsigned int &fwVer, unsigned int &fwCrc)
+{
+    if (bus >= cNumMdioBus)
+    {
+        return -1;
+    }
+
+    // Not while a load is in progress on the bus
+    std::lock_guard<std::mutex> busLck(myMdioBusMtx[bus]);
+
+    const unsigned int *allPhyIdx = (bus == cTopMz) ? cPhyIdx1 : cPhyIdx0;
+    unsigned int numAllPhyIdx = (bus == cTopMz) ? cNumPhyIdx1 : cNumPhyIdx0;
+
+    bcm_plp_access_t  phyInfo;
+    memset(&phyInfo, 0, sizeof(bcm_plp_access_t));
+    phyInfo.platform_ctxt = (void*)(&bus);
+
+    // Firmware info needs the phy contexts of this process set up first
+    if (!myIsPlpInit[bus] && (initFwSkip(bus, allPhyIdx, numAllPhyIdx) != 0))
+    {
+        return -1;
+    }
+
+    for (unsigned int phyId = 0; phyId < numAllPhyIdx; ++phyId)
+    {
+        unsigned int ver = 0, crc = 0;
+
+        phyInfo.phy_addr = allPhyIdx[phyId];
+
+        if (bcm_plp_firmware_info_get(myMilleniObPtr, phyInfo, &ver, &crc) != 0)
+        {
+            return -1;
+        }
+
+        if ((phyId != 0) && ((ver != fwVer) || (crc != fwCrc)))
+        {
+            return 1;
+        }
+
+        fwVer = ver;
+        fwCrc = crc;
+    }
+
+    return 0;
+}
+
+bool Bcm81725::isFwCurrent(const unsigned int &bus, unsigned int phyAddr)
+{
+    unsigned int imageVer, imageCrc;
+    {
+        std::lock_guard<std::mutex> lck(myFwImageMtx);
+
+        if (!myIsFwImageKnown)
+        {
+            return false;
+        }
+
+        imageVer = myFwImageVer;
+        imageCrc = myFwImageCrc;
+    }
+
+    bcm_plp_access_t  phyInfo;
+    memset(&phyInfo, 0, sizeof(bcm_plp_access_t));
+    phyInfo.platform_ctxt = (void*)(&bus);
+    phyInfo.phy_addr = phyAddr;
+
+    unsigned int fwVer = 0, fwCrc = 0;
+
+    // Fails on a core with no firmware running, e.g. after mezz power cycle
+    if (bcm_plp_firmware_info_get(myMilleniObPtr, phyInfo, &fwVer, &fwCrc) != 0)
+    {
+        return false;
+    }
+
+    std::ostringstream  log;
+    log << " mz=" << bus << std::hex << " phy=" << phyAddr
+        << " fwVer = " << fwVer << " fwCrc = " << fwCrc << std::dec;
+    addLog(__func__, __LINE__, log.str());
+
+    return ((fwVer == imageVer) && (fwCrc == imageCrc));
+}
+
+void Bcm81725::readFwImageInfo()
+{
+    std::ifstream ifs(fwImageInfoFile());
+
+    unsigned int buildKey, fwVer, fwCrc;
+
+    if ((ifs >> std::hex >> buildKey >> fwVer >> fwCrc) && (buildKey == fwImageBuildKey()))
+    {
+        std::lock_guard<std::mutex> lck(myFwImageMtx);
+
+        myFwImageVer = fwVer;
+        myFwImageCrc = fwCrc;
+        myIsFwImageKnown = true;
+    }
+}
+
+void Bcm81725::saveFwImageInfo(unsigned int fwVer, unsigned int fwCrc)
+{
+    std::lock_guard<std::mutex> lck(myFwImageMtx);
+
+    if (myIsFwImageKnown && (fwVer == myFwImageVer) && (fwCrc == myFwImageCrc))
+    {
+        return;
+    }
+
+    myFwImageVer = fwVer;
+    myFwImageCrc = fwCrc;
+    myIsFwImageKnown = true;
+
+    // Replaced whole so a reset mid write cannot leave a torn record
+    std::string fileName = fwImageInfoFile();
+    std::string tmpName  = fileName + ".tmp";
+    {
+        std::ofstream ofs(tmpName, std::ios::trunc);
+
+        ofs << std::hex << fwImageBuildKey() << " " << fwVer << " " << fwCrc << endl;
+
+        if (!ofs.flush())
+        {
+            return;
+        }
+    }
+
+    rename(tmpName.c_str(), fileName.c_str());
+}
+
+const char* Bcm81725::fwLoadPathToStr(FwLoadPath path)
+{
+    switch (path)
+    {
+        case FW_LOAD_SKIPPED: return "skipped";
+        case FW_LOAD_PARTIAL: return "partial";
+        case FW_LOAD_FULL:    return "full";
+        case FW_LOAD_FAILED:  return "failed";
+        default:              return "none";
+    }
+}
+
 int Bcm81725::LoadMz(const unsigned int &loadFwMz, const mzPolarity * setPolMz)
 {
     std::ostringstream  log;
     int rc = 0;
 
+    if (loadFwMz >= cNumMdioBus)
+    {
+        log << " invalid mz " << loadFwMz;
+        addLog(__func__, __LINE__, log.str());
+        return -1;
+    }
+
+    // MDIO transactions are serialized by myBcmMtx inside FpgaMdioIf;
+    // this keeps the multi step broadcast sequence on a bus intact
+    std::lock_guard<std::mutex> busLck(myMdioBusMtx[loadFwMz]);
+
+    RegCallerScope callerScope(REG_CALLER_INIT);
 
     if (loadFirmware(loadFwMz))
     {
@@ -553,15 +909,28 @@ int Bcm81725::init(const string &mEnvStr)
     if (mEnvStr != "hb")
     {
 
-        if (mEnvStr == "" || mEnvStr == "bmz")
+        if (mEnvStr == "")
         {
+            // Mezz sit on their own MDIO bus; load both at once
+            int rcTop = 0;
+
+            std::thread thrTop([&]{ rcTop = LoadMz(cTopMz, topMzPol); });
+
             rc += LoadMz(cBottomMz, bottomMzPol);
             std::cout << " Loaded bottom mz" << endl;
-        }
 
+            thrTop.join();
 
+            rc += rcTop;
+            std::cout << " Loaded top mz" << endl;
+        }
+        else if (mEnvStr == "bmz")
+        {
+            rc += LoadMz(cBottomMz, bottomMzPol);
+            std::cout << " Loaded bottom mz" << endl;
+        }
         // if top mz load this
-        if (mEnvStr == "" || mEnvStr == "tmz")
+        else if (mEnvStr == "tmz")
         {
             rc += LoadMz(cTopMz, topMzPol);
             std::cout << " Loaded top mz" << endl;
@@ -596,6 +965,30 @@ void Bcm81725::dumpLog(std::ostream &os)
 
 void Bcm81725::dumpStatus(std::ostream &os, std::string cmd) 
 {
+    if (cmd == "fw")
+    {
+        os << "<<<<<<<<<<<<<<<<<<< Bcm81725.dumpStatus fw >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
+
+        {
+            std::lock_guard<std::mutex> lck(myFwImageMtx);
+
+            if (myIsFwImageKnown)
+            {
+                os << "Image fwVer = 0x" << std::hex << myFwImageVer
+                   << " fwCrc = 0x" << myFwImageCrc << std::dec << endl;
+            }
+            else
+            {
+                os << "Image info unknown, next load is forced" << endl;
+            }
+        }
+
+        for (unsigned int bus = 0; bus < cNumMdioBus; bus++)
+        {
+            os << "mz=" << bus << " load path: " << fwLoadPathToStr(myFwLoadPath[bus])
+               << " cores loaded: " << myNumFwCoresLoaded[bus] << endl;
+        }
+    }
 }
 
 void Bcm81725::resetLog( std::ostream &os )
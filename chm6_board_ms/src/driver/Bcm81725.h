@@ -31,6 +31,19 @@ public:
 
     static const unsigned int cNumPolarities = 6;
 
+    // MDIO bus per mezz: bottom-0 top-1
+    static const unsigned int cNumMdioBus = 2;
+
+    // Path taken by the last firmware load on a bus
+    typedef enum
+    {
+        FW_LOAD_NONE = 0,
+        FW_LOAD_SKIPPED,   // all cores already run the bundled image
+        FW_LOAD_PARTIAL,   // only out of date cores downloaded
+        FW_LOAD_FULL,      // all cores downloaded
+        FW_LOAD_FAILED
+    } FwLoadPath;
+
     const mzPolarity bottomMzPol[cNumPolarities] = {
                                            { {0, 4  , 0, 0xFFFF}, 519, 25088}, { {0, 4,   1, 0xFF},   0, 0},
                                            { {0, 8  , 0, 0xFFFF},   5, 24576}, { {0, 8,   1, 0xFF},   0, 0},
@@ -54,6 +67,8 @@ public:
     int init(const string & mEnvStr);
 	int loadFirmware(const unsigned int &bus);
 	int warmInit(const Bcm81725Lane& param);
+    // Firmware on every core of bus; -1 if a core does not answer, 1 if cores differ
+    int getFwInfo(const unsigned int &bus, unsigned int &fwVer, unsigned int &fwCrc);
 
     void dumpLog(std::ostream &os);
     void dumpStatus(std::ostream &os, std::string cmd);
@@ -85,6 +100,26 @@ private:
 	FpgaMdioIf* myMdioRAPtr;
 	FpgaRegIf* myFpgaRAPtr;
     // std::recursive_mutex myMdioMtx;
+    // Held for a whole firmware load on one bus; loads on different buses overlap
+    std::mutex myMdioBusMtx[cNumMdioBus];
+
+    bool isFwCurrent(const unsigned int &bus, unsigned int phyAddr);
+    int initFwSkip(const unsigned int &bus, const unsigned int *phyIdx, unsigned int numPhyIdx);
+    int waitCoresReady(const unsigned int &bus, const unsigned int *phyIdx, unsigned int numPhyIdx);
+    void readFwImageInfo();
+    void saveFwImageInfo(unsigned int fwVer, unsigned int fwCrc);
+    static const char* fwLoadPathToStr(FwLoadPath path);
+
+    // Version and CRC of the bundled image, as read back after a forced load
+    std::mutex myFwImageMtx;
+    bool myIsFwImageKnown;
+    unsigned int myFwImageVer;
+    unsigned int myFwImageCrc;
+
+    FwLoadPath myFwLoadPath[cNumMdioBus];
+    unsigned int myNumFwCoresLoaded[cNumMdioBus];
+    // PLP phy contexts and accessors installed in this process
+    bool myIsPlpInit[cNumMdioBus];
 	std::mutex myLogMtx;
 	SimpleLog::Log*  myLogPtr;
 
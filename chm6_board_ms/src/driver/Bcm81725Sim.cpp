@@ -18,4 +18,11 @@ int Bcm81725Sim::init(const string &mEnvStr)
     return 0;
 }
 
+int Bcm81725Sim::getFwInfo(const unsigned int &bus, unsigned int &fwVer, unsigned int &fwCrc)
+{
+    fwVer = 0;
+    fwCrc = 0;
+    return 0;
+}
+
 }
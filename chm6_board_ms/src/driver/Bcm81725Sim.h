@@ -14,6 +14,8 @@ public:
 	~Bcm81725Sim();
     
     int init(const string &mEnvStr);
+
+    int getFwInfo(const unsigned int &bus, unsigned int &fwVer, unsigned int &fwCrc);
 private:
 
 };
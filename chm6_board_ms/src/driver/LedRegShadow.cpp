@@ -0,0 +1,197 @@
+/*
+ * LedRegShadow.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <boost/format.hpp>
+
+#include "LedRegShadow.h"
+#include "InfnLogger.h"
+#include "RegIfException.h"
+
+LedRegShadow::LedRegShadow(const RegIfProbe<FpgaMiscIf>* pIntf)
+    : mpFpgaMiscIf(pIntf)
+    , mNumVerifies(0)
+{
+}
+
+void LedRegShadow::AddField(uint32 regOffset, uint32 mask)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mShadowRegs[regOffset].mFieldMask |= mask;
+}
+
+LedRegShadow::ShadowReg& LedRegShadow::GetLoadedReg(uint32 regOffset)
+{
+    ShadowReg& reg = mShadowRegs[regOffset];
+
+    if (!reg.mIsValid)
+    {
+        reg.mValue   = mpFpgaMiscIf->Read32(regOffset);
+        reg.mIsValid = true;
+        reg.mNumHwReads++;
+    }
+
+    return reg;
+}
+
+void LedRegShadow::WriteField(uint32 regOffset, uint32 mask, uint32 bits)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    ShadowReg& reg = GetLoadedReg(regOffset);
+
+    uint32 value = (reg.mValue & ~mask) | (bits & mask);
+
+    mpFpgaMiscIf->Write32(regOffset, value);
+
+    // Only after the write went out
+    reg.mValue = value;
+    reg.mNumWrites++;
+}
+
+uint32 LedRegShadow::WriteFields(const std::vector<FieldWrite>& fields)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    std::map<uint32, uint32> images;
+
+    for (auto& field : fields)
+    {
+        auto it = images.find(field.mRegOffset);
+
+        if (it == images.end())
+        {
+            it = images.insert(std::make_pair(field.mRegOffset, GetLoadedReg(field.mRegOffset).mValue)).first;
+        }
+
+        it->second = (it->second & ~field.mMask) | (field.mBits & field.mMask);
+    }
+
+    uint32 numRegWrites = 0;
+
+    for (auto& image : images)
+    {
+        ShadowReg& reg = mShadowRegs[image.first];
+
+        if (reg.mValue == image.second)
+        {
+            continue;
+        }
+
+        mpFpgaMiscIf->Write32(image.first, image.second);
+
+        reg.mValue = image.second;
+        reg.mNumWrites++;
+        numRegWrites++;
+    }
+
+    return numRegWrites;
+}
+
+uint32 LedRegShadow::ReadField(uint32 regOffset, uint32 mask)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    ShadowReg& reg = GetLoadedReg(regOffset);
+
+    reg.mNumReads++;
+
+    return (reg.mValue & mask);
+}
+
+void LedRegShadow::ReadRegs(const std::vector<uint32>& regOffsets, std::vector<uint32>& values)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    values.resize(regOffsets.size());
+
+    for (uint32 i = 0; i < regOffsets.size(); i++)
+    {
+        ShadowReg& reg = GetLoadedReg(regOffsets[i]);
+
+        reg.mNumReads++;
+
+        values[i] = reg.mValue;
+    }
+}
+
+uint32 LedRegShadow::Verify()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    mNumVerifies++;
+
+    uint32 numDiverged = 0;
+
+    for (auto& it : mShadowRegs)
+    {
+        uint32 regOffset = it.first;
+        ShadowReg& reg   = it.second;
+
+        try
+        {
+            uint32 hwValue = mpFpgaMiscIf->Read32(regOffset);
+            reg.mNumHwReads++;
+
+            if (!reg.mIsValid)
+            {
+                reg.mValue   = hwValue;
+                reg.mIsValid = true;
+                continue;
+            }
+
+            uint32 value = (hwValue & ~reg.mFieldMask) | (reg.mValue & reg.mFieldMask);
+
+            if ((hwValue ^ reg.mValue) & reg.mFieldMask)
+            {
+                INFN_LOG(SeverityLevel::warning) << "LED register 0x" << std::hex << regOffset
+                                                 << " is 0x" << hwValue << " expected 0x" << value
+                                                 << std::dec << ", restoring";
+
+                mpFpgaMiscIf->Write32(regOffset, value);
+
+                reg.mNumMismatches++;
+                numDiverged++;
+            }
+
+            // Bits outside the LED fields follow hardware
+            reg.mValue = value;
+        }
+        catch ( regIf::RegIfException &e )
+        {
+            INFN_LOG(SeverityLevel::error) << "Error: LED register 0x" << std::hex << regOffset
+                                           << std::dec << " verify failed! Ex: " << e.GetError();
+        }
+    }
+
+    return numDiverged;
+}
+
+void LedRegShadow::Dump(std::ostream& os)
+{
+    std::lock_guard<std::mutex> guard(mLock);
+
+    os << "LED register shadow, verify passes: " << mNumVerifies << std::endl;
+
+    os << boost::format("%-6s : %-10s : %-10s : %5s : %10s : %10s : %8s : %8s")
+          % "Offset" % "Value" % "FieldMask" % "Valid" % "Writes" % "Reads" % "HwReads" % "Mismatch"
+       << std::endl;
+
+    for (auto& it : mShadowRegs)
+    {
+        const ShadowReg& reg = it.second;
+
+        os << boost::format("0x%04x : 0x%08x : 0x%08x : %5d : %10d : %10d : %8d : %8d")
+              % it.first
+              % reg.mValue
+              % reg.mFieldMask
+              % reg.mIsValid
+              % reg.mNumWrites
+              % reg.mNumReads
+              % reg.mNumHwReads
+              % reg.mNumMismatches << std::endl;
+    }
+}
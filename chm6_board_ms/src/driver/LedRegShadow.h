@@ -0,0 +1,102 @@
+/*
+ * LedRegShadow.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_DRIVER_LED_REG_SHADOW_H_
+#define CHM6_BOARD_MS_SRC_DRIVER_LED_REG_SHADOW_H_
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "types.h"
+#include "RegIfFactory.h"
+#include "board_reg_probe.h"
+
+/*
+ * Write through shadow of the FPGA LED registers. Field writes go to the
+ * shadow and the hardware without a read; field reads come from the
+ * shadow. A register is read from hardware once, the first time it is
+ * touched. Verify() compares the LED fields against hardware and writes
+ * the shadow back where they differ, e.g. after an FPGA reload.
+ * Exceptions from register access propagate to the caller, except in
+ * Verify().
+ */
+class LedRegShadow
+{
+public:
+
+    struct FieldWrite
+    {
+        uint32 mRegOffset;
+        uint32 mMask;
+        uint32 mBits;
+    };
+
+    explicit LedRegShadow(const RegIfProbe<FpgaMiscIf>* pIntf);
+
+    ~LedRegShadow() {}
+
+    // Declare an LED field; only declared fields are verified
+    void AddField(uint32 regOffset, uint32 mask);
+
+    // bits is already shifted into mask
+    void WriteField(uint32 regOffset, uint32 mask, uint32 bits);
+
+    // Merges all fields first, then writes each changed register once.
+    // Returns the number of registers written.
+    uint32 WriteFields(const std::vector<FieldWrite>& fields);
+
+    // Returns the field still in place, i.e. masked but not shifted
+    uint32 ReadField(uint32 regOffset, uint32 mask);
+
+    // Whole registers, all under one lock
+    void ReadRegs(const std::vector<uint32>& regOffsets, std::vector<uint32>& values);
+
+    // Returns the number of registers that had diverged
+    uint32 Verify();
+
+    void Dump(std::ostream& os);
+
+private:
+
+    struct ShadowReg
+    {
+        ShadowReg()
+        : mValue(0)
+        , mFieldMask(0)
+        , mIsValid(false)
+        , mNumWrites(0)
+        , mNumReads(0)
+        , mNumHwReads(0)
+        , mNumMismatches(0)
+        {}
+
+        uint32 mValue;
+
+        // Union of the declared LED fields
+        uint32 mFieldMask;
+
+        bool mIsValid;
+
+        uint64 mNumWrites;
+        uint64 mNumReads;
+        uint64 mNumHwReads;
+        uint64 mNumMismatches;
+    };
+
+    ShadowReg& GetLoadedReg(uint32 regOffset);
+
+    const RegIfProbe<FpgaMiscIf>* mpFpgaMiscIf;
+
+    std::map<uint32, ShadowReg> mShadowRegs;
+
+    uint64 mNumVerifies;
+
+    std::mutex mLock;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_DRIVER_LED_REG_SHADOW_H_ */
@@ -7,7 +7,7 @@
 #include "RegIfException.h"
 #include "InfnLogger.h"
 
-SacModule::SacModule(std::string name, RegIf *pIntf)
+SacModule::SacModule(std::string name, const RegIfProbe<RegIf> *pIntf)
   : mName(name)
   , mFpgaRegIf(pIntf)
   , mIsTxEnabled(false)
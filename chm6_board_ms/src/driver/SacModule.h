@@ -10,6 +10,7 @@
 
 #include "types.h"
 #include "FpgaRegIf.h"
+#include "board_reg_probe.h"
 
 const uint32 cFpgaSacModuleOffset = 0x17000;
 
@@ -61,7 +62,7 @@ const uint32 cSacStatusRxSclkErrMask = 0x1 << 2;
 class SacModule
 {
 public:
-    SacModule(std::string name, RegIf *pIntf);
+    SacModule(std::string name, const RegIfProbe<RegIf> *pIntf);
 
     ~SacModule();
 
@@ -83,7 +84,7 @@ private:
 
     std::string mName;
 
-    RegIf* mFpgaRegIf;
+    const RegIfProbe<RegIf>* mFpgaRegIf;
 
     bool mIsTxEnabled;
 
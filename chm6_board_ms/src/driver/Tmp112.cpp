@@ -16,7 +16,7 @@
 #include "InfnLogger.h"
 #include "RegIfException.h"
 
-Tmp112::Tmp112(std::string name, FpgaI2cIf *pIntf)
+Tmp112::Tmp112(std::string name, const RegIfProbe<FpgaI2cIf> *pIntf)
   : mName(name),
     mpI2cIntf(pIntf),
     mOrigData(0),
@@ -238,6 +238,7 @@ void Tmp112::DumpAll(std::ostream& out)
     out << "oneShot        : " << mConfigFields.oneShot << std::endl;
     out << "extendedMode   : " << mConfigFields.extendedMode << std::endl;
     out << "alert          : " << mConfigFields.alert << std::endl;
+    out << "convRate       : " << mConfigFields.convRate << " (" << GetConversionPeriodMs() << " ms)" << std::endl;
 
     out << std::endl << "================== Current Temperatures ================== " << std::endl;
 
@@ -364,6 +365,68 @@ void Tmp112::DumpConversion(std::ostream& out)
     }
 }
 
+uint32 Tmp112::GetConversionPeriodMs()
+{
+    std::lock_guard<std::recursive_mutex> guard(mLock);
+
+    return cConvRatePeriodMs[mConfigFields.convRate & 0x3];
+}
+
+int Tmp112::SetAlertMode(float lowLimit, float highLimit)
+{
+    std::lock_guard<std::recursive_mutex> guard(mLock);
+
+    if (GetDefaultConfig())
+    {
+        return -1;
+    }
+
+    if (SetTmpLowLimit(lowLimit) || SetTmpHighLimit(highLimit))
+    {
+        return -1;
+    }
+
+    Tmp112ConfigData config = mConfigFields;
+
+    config.shutDownMode   = 0;
+    config.thermostatMode = 0; // comparator
+    config.alertPolarity  = 0; // active low
+    config.faultQue0      = 1; // 2 consecutive faults
+    config.faultQue1      = 0;
+    config.oneShot        = 0;
+
+    if (SetConfigModes(config))
+    {
+        return -1;
+    }
+
+    INFN_LOG(SeverityLevel::info) << mName << " Alert mode. TLOW: " << lowLimit
+                                  << " C THIGH: " << highLimit << " C";
+
+    return 0;
+}
+
+int Tmp112::GetAlertState(bool& isAlert, bool& isModeSet)
+{
+    std::lock_guard<std::recursive_mutex> guard(mLock);
+
+    if (GetDefaultConfig())
+    {
+        return -1;
+    }
+
+    // AL reads as the POL level while the alert is active
+    isAlert = (mConfigFields.alert == mConfigFields.alertPolarity);
+
+    // Fault queue is 1 at power on; SetAlertMode sets 2
+    isModeSet = ((mConfigFields.thermostatMode == 0) &&
+                 (mConfigFields.alertPolarity  == 0) &&
+                 (mConfigFields.faultQue0      == 1) &&
+                 (mConfigFields.faultQue1      == 0));
+
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int Tmp112::GetDefaultConfig()
@@ -401,6 +464,7 @@ void Tmp112::UpdateConfigCache(uint16 data)
     mConfigFields.oneShot        = (config & cOneShotMask)        >> cOneShotBitpos;
     mConfigFields.extendedMode   = (config & cExtendedModeMask)   >> cExtendedModeBitpos;
     mConfigFields.alert          = (config & cAlertMask)          >> cAlertBitpos;
+    mConfigFields.convRate       = (config & cConvRateMask)       >> cConvRateBitpos;
 }
 
 uint16 Tmp112::GetConfigBytes(Tmp112ConfigData& config)
@@ -417,6 +481,7 @@ uint16 Tmp112::GetConfigBytes(Tmp112ConfigData& config)
     data |= ((config.oneShot        & 0x1) << cOneShotBitpos);
     data |= ((config.extendedMode   & 0x1) << cExtendedModeBitpos);
     data |= ((config.alert          & 0x1) << cAlertBitpos);
+    data |= ((config.convRate       & 0x3) << cConvRateBitpos);
 
     uint16 ret = (data << 8) | (data >> 8);
 
@@ -11,6 +11,7 @@
 
 #include "types.h"
 #include "FpgaI2cIf.h"
+#include "board_reg_probe.h"
 
 const uint32 cTmpRegOffset   = 0;
 const uint32 cConfRegOffset  = 1;
@@ -76,6 +77,12 @@ const uint16 cExtendedModeMask   = 0x1 << cExtendedModeBitpos;
 const uint32 cAlertBitpos  = 5;
 const uint16 cAlertMask    = 0x1 << cAlertBitpos;
 
+// CR1/CR0: conversion rate. 00 - 0.25Hz; 01 - 1Hz; 10 - 4Hz (default); 11 - 8Hz
+const uint32 cConvRateBitpos = 6;
+const uint16 cConvRateMask   = 0x3 << cConvRateBitpos;
+
+const uint32 cConvRatePeriodMs[] = {4000, 1000, 250, 125};
+
 // TLOW and THIGH Register
 const uint32 cTmpLimitNomModeDataShift   = cTmpRegNomModeDataShift;
 const uint16 cTmpLimitNomModeDataMask    = cTmpRegNomModeDataMask;
@@ -100,12 +107,13 @@ struct Tmp112ConfigData
     uint16 oneShot : 1;
     uint16 extendedMode : 1;
     uint16 alert : 1;
+    uint16 convRate : 2;
 };
 
 class Tmp112
 {
 public:
-    Tmp112(std::string name, FpgaI2cIf *pIntf);
+    Tmp112(std::string name, const RegIfProbe<FpgaI2cIf> *pIntf);
 
     ~Tmp112();
 
@@ -129,6 +137,25 @@ public:
 
     void DumpConversion(std::ostream& out);
 
+    // Time between conversions at the configured conversion rate
+    uint32 GetConversionPeriodMs();
+
+    /*
+     * Program TLOW/THIGH and put the part in comparator mode:
+     * ALERT active low, set after 2 consecutive conversions above THIGH,
+     * cleared after 2 below TLOW.
+     */
+    int SetAlertMode(float lowLimit, float highLimit);
+
+    /*
+     * Comparator state from the AL bit; no ALERT pin needed.
+     * isModeSet is false once the part is back at its power-on config,
+     * e.g. after a mezz power cycle; AL then follows the default limits.
+     */
+    int GetAlertState(bool& isAlert, bool& isModeSet);
+
+    const std::string& GetName() { return mName; }
+
 private:
 
     int GetDefaultConfig();
@@ -143,7 +170,7 @@ private:
 
     std::string mName;
 
-    FpgaI2cIf* mpI2cIntf;
+    const RegIfProbe<FpgaI2cIf>* mpI2cIntf;
 
     uint16 mConfigData; // little endian
     Tmp112ConfigData mConfigFields;
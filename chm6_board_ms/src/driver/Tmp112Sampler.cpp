@@ -0,0 +1,394 @@
+/*
+ * Tmp112Sampler.cpp
+ *
+ *  Created on: Oct 16, 2020
+ */
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <boost/bind.hpp>
+#include <boost/format.hpp>
+
+#include "Tmp112Sampler.h"
+#include "board_reg_stats.h"
+#include "InfnLogger.h"
+
+const uint32 Tmp112Sampler::cMinSamplePeriodMs;
+const uint32 Tmp112Sampler::cAlertModeRetrySamples;
+
+Tmp112Sampler::Tmp112Sampler()
+    : mIsStarted(false)
+    , mThrdExit(false)
+{
+}
+
+Tmp112Sampler::~Tmp112Sampler()
+{
+    mThrdExit = true;
+
+    if (mIsStarted)
+    {
+        mThr.join();
+    }
+}
+
+void Tmp112Sampler::AddSensor(Tmp112SensorType type, Tmp112* pTmp112)
+{
+    if ((type >= NUM_TMP112_SENSORS) || mIsStarted)
+    {
+        return;
+    }
+
+    SensorCache& sensor = maSensors[type];
+
+    sensor.mpTmp112 = pTmp112;
+
+    // Round up to a whole number of conversions
+    uint32 convMs = pTmp112->GetConversionPeriodMs();
+
+    sensor.mPeriodMs = ((cMinSamplePeriodMs + convMs - 1) / convMs) * convMs;
+
+    INFN_LOG(SeverityLevel::info) << "TMP112 sampler: " << SensorTypeToStr(type)
+                                  << " conversion: " << convMs << " ms"
+                                  << " sample period: " << sensor.mPeriodMs << " ms";
+}
+
+void Tmp112Sampler::Start()
+{
+    RegCallerScope callerScope(REG_CALLER_PM);
+
+    if (mIsStarted)
+    {
+        return;
+    }
+
+    // First reading before any reader asks
+    for (auto& sensor : maSensors)
+    {
+        if (sensor.mpTmp112)
+        {
+            Sample(sensor);
+        }
+    }
+
+    mThr = boost::thread(boost::bind(
+            &Tmp112Sampler::SampleWorker, this
+            ));
+
+    mIsStarted = true;
+}
+
+void Tmp112Sampler::SetAlertMode(Tmp112SensorType type, float32 lowLimit, float32 highLimit)
+{
+    if (type >= NUM_TMP112_SENSORS)
+    {
+        return;
+    }
+
+    SensorCache& sensor = maSensors[type];
+
+    sensor.mAlertLowLimit  = lowLimit;
+    sensor.mAlertHighLimit = highLimit;
+
+    // Applied on the sampler thread with the next sample
+    sensor.mIsAlertModeSet = false;
+    sensor.mIsAlertModeReq = true;
+}
+
+void Tmp112Sampler::SetAlertCallback(boost::function<void()> alertCb)
+{
+    std::lock_guard<std::mutex> guard(mAlertCbLock);
+
+    mAlertCb = alertCb;
+}
+
+bool Tmp112Sampler::GetReading(Tmp112SensorType type, Tmp112Reading& reading) const
+{
+    if (type >= NUM_TMP112_SENSORS)
+    {
+        return false;
+    }
+
+    const SensorCache& sensor = maSensors[type];
+
+    while (true)
+    {
+        uint32 seq = sensor.mSeq.load(std::memory_order_acquire);
+
+        if (seq & 1)
+        {
+            // Write in progress
+            continue;
+        }
+
+        uint32 tmpBits = sensor.mTmpBits.load(std::memory_order_relaxed);
+
+        reading.mTimestamp.tv_sec  = sensor.mTimeSec.load(std::memory_order_relaxed);
+        reading.mTimestamp.tv_nsec = sensor.mTimeNsec.load(std::memory_order_relaxed);
+        reading.mIsValid           = sensor.mIsValid.load(std::memory_order_relaxed);
+        reading.mIsAlert           = sensor.mIsAlert.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (sensor.mSeq.load(std::memory_order_relaxed) == seq)
+        {
+            memcpy(&reading.mTemperature, &tmpBits, sizeof(reading.mTemperature));
+
+            return (seq != 0);
+        }
+    }
+}
+
+void Tmp112Sampler::SampleWorker()
+{
+    RegCallerScope callerScope(REG_CALLER_PM);
+
+    INFN_LOG(SeverityLevel::info) << "TMP112 sampler: started";
+
+    auto now = std::chrono::steady_clock::now();
+
+    std::chrono::steady_clock::time_point aNextSample[NUM_TMP112_SENSORS];
+
+    for (uint32 i = 0; i < NUM_TMP112_SENSORS; i++)
+    {
+        aNextSample[i] = now + std::chrono::milliseconds(maSensors[i].mPeriodMs);
+    }
+
+    while (!mThrdExit)
+    {
+        auto wakeUp = now + std::chrono::milliseconds(cMinSamplePeriodMs);
+
+        for (uint32 i = 0; i < NUM_TMP112_SENSORS; i++)
+        {
+            if (maSensors[i].mpTmp112 && (aNextSample[i] < wakeUp))
+            {
+                wakeUp = aNextSample[i];
+            }
+        }
+
+        std::this_thread::sleep_until(wakeUp);
+
+        now = std::chrono::steady_clock::now();
+
+        bool isAlertChanged = false;
+
+        for (uint32 i = 0; i < NUM_TMP112_SENSORS; i++)
+        {
+            SensorCache& sensor = maSensors[i];
+
+            if (!sensor.mpTmp112 || (aNextSample[i] > now))
+            {
+                continue;
+            }
+
+            isAlertChanged |= Sample(sensor);
+
+            // Stay on the conversion grid; skip slots missed while the bus was slow
+            do
+            {
+                aNextSample[i] += std::chrono::milliseconds(sensor.mPeriodMs);
+            } while (aNextSample[i] <= now);
+        }
+
+        if (isAlertChanged)
+        {
+            std::lock_guard<std::mutex> guard(mAlertCbLock);
+
+            if (mAlertCb)
+            {
+                mAlertCb();
+            }
+        }
+    }
+
+    INFN_LOG(SeverityLevel::info) << "TMP112 sampler: finished";
+}
+
+bool Tmp112Sampler::Sample(SensorCache& sensor)
+{
+    float32 tmp = 0;
+
+    bool isValid = (sensor.mpTmp112->GetTmperature(tmp) == 0);
+
+    bool isAlert = sensor.mIsAlert.load(std::memory_order_relaxed);
+    bool isAlertChanged = false;
+
+    if (isValid && sensor.mIsAlertModeReq)
+    {
+        // Back after failed reads: the part may have been power cycled
+        if (!sensor.mWasValid)
+        {
+            sensor.mIsAlertModeSet = false;
+            sensor.mAlertModeRetry = 0;
+        }
+
+        if (!sensor.mIsAlertModeSet)
+        {
+            ApplyAlertMode(sensor);
+        }
+
+        bool newAlert = PollAlert(sensor, tmp, isAlert);
+
+        isAlertChanged = (newAlert != isAlert);
+        isAlert = newAlert;
+    }
+
+    sensor.mWasValid = isValid;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    sensor.mNumReads.fetch_add(1, std::memory_order_relaxed);
+
+    // Single writer: sequence goes odd, fields, then even
+    uint32 seq = sensor.mSeq.load(std::memory_order_relaxed);
+
+    sensor.mSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (isValid)
+    {
+        uint32 tmpBits;
+        memcpy(&tmpBits, &tmp, sizeof(tmpBits));
+
+        sensor.mTmpBits.store(tmpBits, std::memory_order_relaxed);
+        sensor.mTimeSec.store(ts.tv_sec, std::memory_order_relaxed);
+        sensor.mTimeNsec.store(ts.tv_nsec, std::memory_order_relaxed);
+    }
+    else
+    {
+        // Keep last good value and its time
+        sensor.mNumFails.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    sensor.mIsValid.store(isValid, std::memory_order_relaxed);
+    sensor.mIsAlert.store(isAlert, std::memory_order_relaxed);
+
+    sensor.mSeq.store(seq + 2, std::memory_order_release);
+
+    if (isAlertChanged)
+    {
+        sensor.mNumAlertChanges.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return isAlertChanged;
+}
+
+void Tmp112Sampler::ApplyAlertMode(SensorCache& sensor)
+{
+    if (sensor.mAlertModeRetry > 0)
+    {
+        sensor.mAlertModeRetry--;
+        return;
+    }
+
+    if (sensor.mpTmp112->SetAlertMode(sensor.mAlertLowLimit, sensor.mAlertHighLimit) == 0)
+    {
+        sensor.mIsAlertModeSet  = true;
+        sensor.mIsThresholdPoll = false;
+        sensor.mNumAlertModeSets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (!sensor.mIsThresholdPoll)
+    {
+        INFN_LOG(SeverityLevel::error) << "TMP112 sampler: " << sensor.mpTmp112->GetName()
+                                       << " alert mode write failed. Polling thresholds";
+    }
+
+    sensor.mIsThresholdPoll = true;
+    sensor.mAlertModeRetry  = cAlertModeRetrySamples;
+}
+
+bool Tmp112Sampler::PollAlert(SensorCache& sensor, float32 tmp, bool isAlert)
+{
+    if (sensor.mIsThresholdPoll)
+    {
+        // Comparator mode in software: set at THIGH, clear below TLOW
+        return (isAlert ? (tmp >= sensor.mAlertLowLimit) : (tmp >= sensor.mAlertHighLimit));
+    }
+
+    bool newAlert;
+    bool isModeSet;
+
+    if (sensor.mpTmp112->GetAlertState(newAlert, isModeSet) != 0)
+    {
+        return isAlert;
+    }
+
+    if (!isModeSet)
+    {
+        // Power-on limits; AL is meaningless until the mode is re-applied next sample
+        INFN_LOG(SeverityLevel::info) << "TMP112 sampler: " << sensor.mpTmp112->GetName()
+                                      << " lost alert mode. Re-applying";
+
+        sensor.mIsAlertModeSet = false;
+        sensor.mAlertModeRetry = 0;
+        return isAlert;
+    }
+
+    return newAlert;
+}
+
+void Tmp112Sampler::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< Tmp112Sampler.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    os << boost::format("%-12s : %10s : %6s : %10s : %10s : %10s : %8s : %6s : %8s : %9s : %8s")
+          % "Sensor" % "Temp(C)" % "Valid" % "Age(ms)" % "Period(ms)" % "Reads" % "Fails"
+          % "Alert" % "Changes" % "AlertSrc" % "ModeSets" << std::endl;
+
+    for (uint32 i = 0; i < NUM_TMP112_SENSORS; i++)
+    {
+        const SensorCache& sensor = maSensors[i];
+
+        if (!sensor.mpTmp112)
+        {
+            continue;
+        }
+
+        Tmp112Reading reading;
+        GetReading(Tmp112SensorType(i), reading);
+
+        sint64 ageMs = (now.tv_sec - reading.mTimestamp.tv_sec) * 1000
+                     + (now.tv_nsec - reading.mTimestamp.tv_nsec) / 1000000;
+
+        const char* pAlertSrc = (!sensor.mIsAlertModeReq ? "-" :
+                                 (sensor.mIsThresholdPoll ? "Threshold" :
+                                  (sensor.mIsAlertModeSet ? "AL bit" : "Pending")));
+
+        os << boost::format("%-12s : %10.4f : %6s : %10d : %10d : %10d : %8d : %6s : %8d : %9s : %8d")
+              % SensorTypeToStr(Tmp112SensorType(i))
+              % reading.mTemperature
+              % (reading.mIsValid ? "yes" : "no")
+              % ageMs
+              % sensor.mPeriodMs
+              % sensor.mNumReads.load()
+              % sensor.mNumFails.load()
+              % (sensor.mIsAlertModeReq ? (reading.mIsAlert ? "yes" : "no") : "-")
+              % sensor.mNumAlertChanges.load()
+              % pAlertSrc
+              % sensor.mNumAlertModeSets.load() << std::endl;
+    }
+}
+
+std::string Tmp112Sampler::SensorTypeToStr(Tmp112SensorType type)
+{
+    switch (type)
+    {
+        case TMP112_INLET:
+            return std::string("Inlet");
+        case TMP112_OUTLET:
+            return std::string("Outlet");
+        case TMP112_TOP_MEZZ:
+            return std::string("TopMezz");
+        case TMP112_BOTTOM_MEZZ:
+            return std::string("BottomMezz");
+        default:
+            return std::string("Unknown");
+    }
+}
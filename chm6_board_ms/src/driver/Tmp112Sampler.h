@@ -0,0 +1,173 @@
+/*
+ * Tmp112Sampler.h
+ *
+ *  Created on: Oct 16, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_DRIVER_TMP112_SAMPLER_H_
+#define CHM6_BOARD_MS_SRC_DRIVER_TMP112_SAMPLER_H_
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <time.h>
+#include <boost/thread.hpp>
+#include <boost/function.hpp>
+
+#include "types.h"
+#include "Tmp112.h"
+
+typedef enum Tmp112SensorType
+{
+    TMP112_INLET = 0,
+    TMP112_OUTLET,
+    TMP112_TOP_MEZZ,
+    TMP112_BOTTOM_MEZZ,
+    NUM_TMP112_SENSORS
+} Tmp112SensorType;
+
+struct Tmp112Reading
+{
+    Tmp112Reading()
+    : mTemperature(0)
+    , mTimestamp{0, 0}
+    , mIsValid(false)
+    , mIsAlert(false)
+    {}
+
+    float32 mTemperature;
+
+    // Time of the last good read, CLOCK_REALTIME
+    struct timespec mTimestamp;
+
+    // False until the first good read and after a failed read
+    bool mIsValid;
+
+    // Comparator alert, only for sensors with alert polling enabled
+    bool mIsAlert;
+};
+
+/*
+ * Samples all TMP112 sensors on one thread, each at a multiple of its
+ * conversion period. Readings are published through a per sensor
+ * seqlock so readers never block and never touch the I2C bus.
+ */
+class Tmp112Sampler
+{
+public:
+
+    Tmp112Sampler();
+
+    ~Tmp112Sampler();
+
+    void AddSensor(Tmp112SensorType type, Tmp112* pTmp112);
+
+    void Start();
+
+    /*
+     * Comparator alert for parts whose ALERT pin is not wired. The sampler
+     * programs the limits and reads the AL bit with each sample. Alert mode
+     * is re-applied whenever the part comes back at its power-on config,
+     * e.g. after a mezz power cycle or re-init. While the mode cannot be
+     * written the alert is derived from the sampled temperature instead.
+     */
+    void SetAlertMode(Tmp112SensorType type, float32 lowLimit, float32 highLimit);
+
+    // Called on the sampler thread whenever a polled alert changes
+    void SetAlertCallback(boost::function<void()> alertCb);
+
+    // Latest cached reading; returns false if the sensor was never read
+    bool GetReading(Tmp112SensorType type, Tmp112Reading& reading) const;
+
+    void Dump(std::ostream& os);
+
+    static std::string SensorTypeToStr(Tmp112SensorType type);
+
+    // Sample period floor; sensors converting faster are read every Nth conversion
+    static const uint32 cMinSamplePeriodMs = 1000;
+
+    // Samples between retries of a failed alert mode write
+    static const uint32 cAlertModeRetrySamples = 30;
+
+private:
+
+    struct SensorCache
+    {
+        SensorCache()
+        : mpTmp112(nullptr)
+        , mPeriodMs(cMinSamplePeriodMs)
+        , mSeq(0)
+        , mTmpBits(0)
+        , mTimeSec(0)
+        , mTimeNsec(0)
+        , mIsValid(false)
+        , mIsAlert(false)
+        , mIsAlertModeReq(false)
+        , mAlertLowLimit(0)
+        , mAlertHighLimit(0)
+        , mIsAlertModeSet(false)
+        , mIsThresholdPoll(false)
+        , mWasValid(false)
+        , mAlertModeRetry(0)
+        , mNumAlertModeSets(0)
+        , mNumReads(0)
+        , mNumFails(0)
+        , mNumAlertChanges(0)
+        {}
+
+        Tmp112* mpTmp112;
+
+        uint32 mPeriodMs;
+
+        // Odd while the sampler is writing
+        std::atomic<uint32> mSeq;
+
+        std::atomic<uint32> mTmpBits;
+        std::atomic<sint64> mTimeSec;
+        std::atomic<sint32> mTimeNsec;
+        std::atomic<bool>   mIsValid;
+        std::atomic<bool>   mIsAlert;
+
+        // Requested alert mode; limits are stored before the request
+        std::atomic<bool>    mIsAlertModeReq;
+        std::atomic<float32> mAlertLowLimit;
+        std::atomic<float32> mAlertHighLimit;
+
+        // Sampler thread state
+        std::atomic<bool>   mIsAlertModeSet;
+        std::atomic<bool>   mIsThresholdPoll;
+        bool                mWasValid;
+        uint32              mAlertModeRetry;
+
+        std::atomic<uint64> mNumAlertModeSets;
+
+        std::atomic<uint64> mNumReads;
+        std::atomic<uint64> mNumFails;
+        std::atomic<uint64> mNumAlertChanges;
+    };
+
+    void SampleWorker();
+
+    // Returns true if the polled alert changed
+    bool Sample(SensorCache& sensor);
+
+    void ApplyAlertMode(SensorCache& sensor);
+
+    // New alert state; keeps isAlert if the state cannot be read
+    bool PollAlert(SensorCache& sensor, float32 tmp, bool isAlert);
+
+    SensorCache maSensors[NUM_TMP112_SENSORS];
+
+    boost::thread mThr;
+
+    std::mutex mAlertCbLock;
+
+    boost::function<void()> mAlertCb;
+
+    bool mIsStarted;
+
+    std::atomic<bool> mThrdExit;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_DRIVER_TMP112_SAMPLER_H_ */
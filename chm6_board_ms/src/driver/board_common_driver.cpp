@@ -7,6 +7,13 @@
 #include <chrono>
 #include <thread>
 #include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <glob.h>
+#include <fstream>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <mtd/mtd-user.h>
 #include <ctype.h>
@@ -15,15 +22,31 @@
 #include "board_common_driver.h"
 #include "RegIfException.h"
 #include "board_defs.h"
+#include "board_ready_wait.h"
+#include "board_init_fprint.h"
 
 
 const uint32 cHbLatchEnDly      = 100; // ms
 const uint32 cMezzPwrEnDly      = 100; // ms
 const uint32 cMezzDisableRstDly = 100; // ms
-const uint32 cLedRegWaitDly     = 100; // ms
-const uint32 cClockRstDly       =  500; // 15; // ms
-const uint32 cClockCfgDly       = 1000; //300; // ms
-const uint32 cGbResetDelayTime  =   5; // seconds
+
+// Name, settle, first poll, max poll, deadline; all ms
+const ReadyWaitSpec cLedReadyWait     = { "FpgaLedReady",      0, 10, 100, 5000 };
+const ReadyWaitSpec cClockRstWait     = { "Si5394Reset",      15,  5,  50,  500 };
+const ReadyWaitSpec cClockCfgWait     = { "Si5394Lock",       50, 10, 100, 1000 };
+const ReadyWaitSpec cGbResetWait      = { "GearboxReset",    100, 20, 500, 5000 };
+
+// Si5394 status registers, page 0
+const uint32 cSi5394DeviceReadyReg    = 0xFE;   // 0x0F once out of reset
+const uint32 cSi5394DeviceReadyVal    = 0x0F;
+const uint32 cSi5394StatusReg         = 0x0C;   // bit0 SYSINCAL
+const uint32 cSi5394SysInCalMask      = 0x01;
+const uint32 cSi5394LolStatusReg      = 0x0E;   // bit1 LOL
+const uint32 cSi5394LolMask           = 0x02;
+
+// UIO device name of the FPGA misc status interrupt; BoardFaultIrqUioName env overrides
+const char* cFaultIrqUioName       = "fpga_misc_status";
+const char* cFaultIrqUioNameEnvStr = "BoardFaultIrqUioName";
 
 
 BoardCommonDriver::BoardCommonDriver(bool isSim, bool isEval)
@@ -43,6 +66,8 @@ BoardCommonDriver::BoardCommonDriver(bool isSim, bool isEval)
   , mspFpgaPlI2c4RegIf(nullptr)
   , mspFpgaPlMdioIf(nullptr)
   , mpBcmDriver(nullptr)
+  , mFaultIrqFd(-1)
+  , mFaultIrqWakeFd(-1)
   , mIsSim(isSim)
   , mIsEval(isEval)
 {
@@ -53,11 +78,25 @@ BoardCommonDriver::BoardCommonDriver(bool isSim, bool isEval)
 
 BoardCommonDriver::~BoardCommonDriver()
 {
+    if (mFaultIrqFd >= 0)
+    {
+        close(mFaultIrqFd);
+    }
 
+    if (mFaultIrqWakeFd >= 0)
+    {
+        close(mFaultIrqWakeFd);
+    }
 }
 
+// Created once; warm init may ask again
 void BoardCommonDriver::CreateBcmDriver()
 {
+    if (NULL != mpBcmDriver)
+    {
+        return;
+    }
+
 #ifdef ARCH_x86
     mpBcmDriver = make_unique<gearboxsim::Bcm81725Sim>();
 #else
@@ -250,63 +289,29 @@ int BoardCommonDriver::PollUntilFpgaLedReady(boardMs::mezzBoardSpecType brdId)
     uint32 data1 = 0;
     uint32 data2 = 0;
 
-    int retVal = -1;
-    try
+    auto isLedReady = [&]()
     {
-        const uint32 cMaxWaitTime = 5000;  // ms
+        // FPGA sets the bits after address config done
+        data1 = 0x111;
+        data2 = 0x111;
 
-        uint32 maxIt = cMaxWaitTime/cLedRegWaitDly;
-        uint32 i = 0;
-        do
+        if (brdId != boardMs::MEZZ_BRD_SPEC_TOP)
         {
-            if (brdId == boardMs::MEZZ_BRD_SPEC_BOTH)
-            {
-                data1 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_1);
-                data2 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_2);
-            }
-            else if (brdId == boardMs::MEZZ_BRD_SPEC_BTM)
-            {
-                data1 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_1);
-                data2 = 0x111; // FPGA set bit4 status after address config done
-            }
-            else if (brdId == boardMs::MEZZ_BRD_SPEC_TOP)
-            {
-                data1 = 0x111;
-                data2 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_2);
-            }
+            data1 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_1);
+        }
 
-            std::cout << "data1 = 0x" << std::hex << data1 << "\t"
-                      << " data2 = 0x" << std::hex << data2 << std::dec << std::endl;
+        if (brdId != boardMs::MEZZ_BRD_SPEC_BTM)
+        {
+            data2 = mspFpgaPlMiscIf->Read32(cFpgaLedCntlReg_2);
+        }
 
-            INFN_LOG(SeverityLevel::info) << "data1 = 0x" << std::hex << data1 << "\t"
-                    << " data2 = 0x" << std::hex << data2 << std::dec;
+        return (((data1 & 0x111) == 0x111) && ((data2 & 0x111) == 0x111));
+    };
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(cLedRegWaitDly));
+    int retVal = BoardReadyWait::WaitUntilReady(cLedReadyWait, isLedReady);
 
-            if (++i > maxIt)
-            {
-                break;
-            }
-
-        }while( ((data1 &= 0x111) != 0x111) || ((data2 &= 0x111) != 0x111) );
-
-        if (i <= maxIt)
-        {
-            retVal = 0;
-        }
-    }
-    catch (regIf::RegIfException &ex)
-    {
-        INFN_LOG(SeverityLevel::error) << "Error: Fpga Access Failed. Ex: " << ex.GetError();
-    }
-    catch(exception& ex)
-    {
-        INFN_LOG(SeverityLevel::error) << "Caught Exception: " << ex.what();
-    }
-    catch( ... )
-    {
-        INFN_LOG(SeverityLevel::error) << "Caught Exception";
-    }
+    INFN_LOG(SeverityLevel::info) << "data1 = 0x" << std::hex << data1 << "\t"
+            << " data2 = 0x" << std::hex << data2 << std::dec;
 
     return retVal;
 }
@@ -471,27 +476,30 @@ int BoardCommonDriver::GetFpgaIoExpInput(boardMs::mezzBoardIdType boardId, uint3
     const uint32 cFpgaCommandByteVal    = 0x80;    // Read Port 0, Auto Incr Enabled
     const uint32 cFpgaCommandByteOffset = 0;
 
-    shared_ptr<FpgaI2cIf> spMezzIoExpIf;
+    const RegIfProbe<FpgaI2cIf>* pMezzIoExpIf = nullptr;
     if (boardId == boardMs::MEZZ_BRD_TOP)
     {
-        spMezzIoExpIf = mspTopMzIoExpIf;
+        pMezzIoExpIf = &mspTopMzIoExpIf;
     }
     else
     {
-        spMezzIoExpIf = mspBottomMzIoExpIf;
+        pMezzIoExpIf = &mspBottomMzIoExpIf;
     }
 
     int errCode = -1;
 
     try
     {
-        spMezzIoExpIf->Write8(cFpgaCommandByteOffset,cFpgaCommandByteVal);
+        // Command byte and the port reads that follow it are one transaction
+        I2cTransaction txn(pMezzIoExpIf->GetBus());
+
+        pMezzIoExpIf->Write8(cFpgaCommandByteOffset,cFpgaCommandByteVal);
 
         // Read byte from each of 3 ports to capture all inputs
         //    (note auto increment is enabled)
-        uint32 allPortVals = ( (spMezzIoExpIf->Read8(cFpgaCommandByteOffset    )      ) |
-                               (spMezzIoExpIf->Read8(cFpgaCommandByteOffset + 1) << 8 ) |
-                               (spMezzIoExpIf->Read8(cFpgaCommandByteOffset + 2) << 16));
+        uint32 allPortVals = ( (pMezzIoExpIf->Read8(cFpgaCommandByteOffset    )      ) |
+                               (pMezzIoExpIf->Read8(cFpgaCommandByteOffset + 1) << 8 ) |
+                               (pMezzIoExpIf->Read8(cFpgaCommandByteOffset + 2) << 16));
 
         regVal = allPortVals;
 
@@ -513,6 +521,222 @@ int BoardCommonDriver::GetFpgaIoExpInput(boardMs::mezzBoardIdType boardId, uint3
     return errCode;
 }
 
+/*
+ * Read each digital input source once for the whole fault cycle.
+ * Sources that fail are marked invalid; the others are still captured.
+ */
+int BoardCommonDriver::GetDigitalInputSnapshot(boardMs::mezzBoardSpecType mezzSpec,
+                                               boardMs::DigitalInputSnapshot &snapshot)
+{
+    int errCode = 0;
+
+    snapshot.mIsFpgaMiscStatusValid =
+        (GetFpgaMiscStatus(snapshot.mFpgaMiscStatus) == 0);
+
+    if (!snapshot.mIsFpgaMiscStatusValid)
+    {
+        errCode = -1;
+    }
+
+    for (const auto brdId : {boardMs::MEZZ_BRD_TOP, boardMs::MEZZ_BRD_BTM})
+    {
+        if ((mezzSpec == boardMs::MEZZ_BRD_SPEC_BOTH) ||
+            (static_cast<uint32>(mezzSpec) == static_cast<uint32>(brdId)))
+        {
+            snapshot.mIsMezzIoExpInputValid[brdId] =
+                (GetFpgaIoExpInput(brdId, snapshot.mMezzIoExpInput[brdId]) == 0);
+
+            if (!snapshot.mIsMezzIoExpInputValid[brdId])
+            {
+                errCode = -1;
+            }
+        }
+        else
+        {
+            snapshot.mIsMezzIoExpInputValid[brdId] = false;
+        }
+    }
+
+    return errCode;
+}
+
+int BoardCommonDriver::OpenFaultIrq()
+{
+    if (mIsSim)
+    {
+        return -1;
+    }
+
+    if (mFaultIrqFd >= 0)
+    {
+        return 0;
+    }
+
+    const char* pEnvStr = getenv(cFaultIrqUioNameEnvStr);
+
+    std::string uioName = (pEnvStr ? pEnvStr : cFaultIrqUioName);
+    std::string uioDev;
+
+    if (FindUioDev(uioName, uioDev) != 0)
+    {
+        INFN_LOG(SeverityLevel::info) << "Fault interrupt UIO device " << uioName << " not found";
+        return -1;
+    }
+
+    int fd = open(uioDev.c_str(), O_RDWR | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        INFN_LOG(SeverityLevel::info) << "Fault interrupt not available on " << uioDev
+                                      << ": " << strerror(errno);
+        return -1;
+    }
+
+    int wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (wakeFd < 0)
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to create fault interrupt wake fd: " << strerror(errno);
+        close(fd);
+        return -1;
+    }
+
+    // Unmask interrupt
+    uint32 irqEn = 1;
+
+    if (write(fd, &irqEn, sizeof(irqEn)) != sizeof(irqEn))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to enable fault interrupt: " << strerror(errno);
+        close(wakeFd);
+        close(fd);
+        return -1;
+    }
+
+    mFaultIrqFd     = fd;
+    mFaultIrqWakeFd = wakeFd;
+
+    INFN_LOG(SeverityLevel::info) << "Fault interrupt enabled on " << uioDev;
+
+    return 0;
+}
+
+// /dev node of the UIO device whose sysfs name is uioName
+int BoardCommonDriver::FindUioDev(const std::string& uioName, std::string& uioDev)
+{
+    glob_t globBuf;
+
+    if (glob("/sys/class/uio/uio*/name", 0, NULL, &globBuf) != 0)
+    {
+        return -1;
+    }
+
+    int errCode = -1;
+
+    for (size_t i = 0; i < globBuf.gl_pathc; i++)
+    {
+        std::string namePath(globBuf.gl_pathv[i]);
+        std::string name;
+
+        std::ifstream nameFile(namePath);
+
+        if (!std::getline(nameFile, name) || (name != uioName))
+        {
+            continue;
+        }
+
+        // /sys/class/uio/uioN/name -> /dev/uioN
+        std::string dir = namePath.substr(0, namePath.rfind('/'));
+
+        uioDev  = "/dev/" + dir.substr(dir.rfind('/') + 1);
+        errCode = 0;
+        break;
+    }
+
+    globfree(&globBuf);
+
+    return errCode;
+}
+
+void BoardCommonDriver::WakeFaultIrq()
+{
+    if (mFaultIrqWakeFd < 0)
+    {
+        return;
+    }
+
+    uint64 wakeCnt = 1;
+
+    if (write(mFaultIrqWakeFd, &wakeCnt, sizeof(wakeCnt)) != sizeof(wakeCnt))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to wake fault interrupt wait: " << strerror(errno);
+    }
+}
+
+int BoardCommonDriver::WaitFaultIrq(uint32 timeoutMs)
+{
+    if (mFaultIrqFd < 0)
+    {
+        return -1;
+    }
+
+    struct pollfd pfd[2];
+    pfd[0].fd      = mFaultIrqFd;
+    pfd[0].events  = POLLIN;
+    pfd[0].revents = 0;
+    pfd[1].fd      = mFaultIrqWakeFd;
+    pfd[1].events  = POLLIN;
+    pfd[1].revents = 0;
+
+    int ret = poll(pfd, 2, timeoutMs);
+
+    if (ret == 0)
+    {
+        return 0;
+    }
+    else if (ret < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+
+        INFN_LOG(SeverityLevel::error) << "Fault interrupt poll failed: " << strerror(errno);
+        return -1;
+    }
+
+    if (pfd[1].revents & POLLIN)
+    {
+        // Woken by WakeFaultIrq; let the caller check its exit
+        uint64 wakeCnt;
+
+        if (read(mFaultIrqWakeFd, &wakeCnt, sizeof(wakeCnt)) < 0)
+        {
+            INFN_LOG(SeverityLevel::debug) << "Fault interrupt wake read: " << strerror(errno);
+        }
+        return 0;
+    }
+
+    // UIO returns the total interrupt count; the count itself is not needed
+    uint32 irqCount;
+
+    if (read(mFaultIrqFd, &irqCount, sizeof(irqCount)) != sizeof(irqCount))
+    {
+        INFN_LOG(SeverityLevel::error) << "Fault interrupt read failed: " << strerror(errno);
+        return -1;
+    }
+
+    // Re-arm for the next interrupt
+    uint32 irqEn = 1;
+
+    if (write(mFaultIrqFd, &irqEn, sizeof(irqEn)) != sizeof(irqEn))
+    {
+        INFN_LOG(SeverityLevel::error) << "Failed to re-enable fault interrupt: " << strerror(errno);
+        return -1;
+    }
+
+    return 1;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -523,37 +747,37 @@ void BoardCommonDriver::CreateRegIf()
 {
     RegIfFactory* pFactory = RegIfFactorySingleton::Instance();
 
-    mspFpgaPlRegIf = pFactory->CreateFpgaPlRegIf();
+    mspFpgaPlRegIf.Attach(pFactory->CreateFpgaPlRegIf(), REG_BUS_FPGA, "FpgaPl");
 
-    mspFpgaPlMiscIf = pFactory->CreateFpgaMiscRegIf();
+    mspFpgaPlMiscIf.Attach(pFactory->CreateFpgaMiscRegIf(), REG_BUS_FPGA, "FpgaMisc");
 
-    mspFpgaPlI2c0RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus0);
+    mspFpgaPlI2c0RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus0), REG_BUS_PL_I2C0, "I2c0");
 
-    mspFpgaPlI2c1RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus1);
+    mspFpgaPlI2c1RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus1), REG_BUS_PL_I2C1, "I2c1");
 
-    mspFpgaPlI2c2RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus2);
+    mspFpgaPlI2c2RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus2), REG_BUS_PL_I2C2, "I2c2");
 
-    mspBottomMzFPC402_1RegIf = pFactory->CreateBottomMzFPC402_1RegIf();
+    mspBottomMzFPC402_1RegIf.Attach(pFactory->CreateBottomMzFPC402_1RegIf(), REG_BUS_PL_I2C2, "BottomMzFPC402_1");
 
-    mspBottomMzFPC402_2RegIf = pFactory->CreateBottomMzFPC402_2RegIf();
+    mspBottomMzFPC402_2RegIf.Attach(pFactory->CreateBottomMzFPC402_2RegIf(), REG_BUS_PL_I2C2, "BottomMzFPC402_2");
 
-    mspBottomMzIoExpIf = pFactory->CreateBottomMzIOExpanderRegIf();
+    mspBottomMzIoExpIf.Attach(pFactory->CreateBottomMzIOExpanderRegIf(), REG_BUS_PL_I2C2, "BottomMzIoExp");
 
     mspBottomMzSi5394Drv = pFactory->CreateBottomMzSi5394Drv();
 
-    mspFpgaPlI2c3RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus3);
+    mspFpgaPlI2c3RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus3), REG_BUS_PL_I2C3, "I2c3");
 
-    mspTopMzFPC402_1RegIf = pFactory->CreateTopMzFPC402_1RegIf();
+    mspTopMzFPC402_1RegIf.Attach(pFactory->CreateTopMzFPC402_1RegIf(), REG_BUS_PL_I2C3, "TopMzFPC402_1");
 
-    mspTopMzFPC402_2RegIf = pFactory->CreateTopMzFPC402_2RegIf();
+    mspTopMzFPC402_2RegIf.Attach(pFactory->CreateTopMzFPC402_2RegIf(), REG_BUS_PL_I2C3, "TopMzFPC402_2");
 
-    mspTopMzIoExpIf = pFactory->CreateTopMzIOExpanderRegIf();
+    mspTopMzIoExpIf.Attach(pFactory->CreateTopMzIOExpanderRegIf(), REG_BUS_PL_I2C3, "TopMzIoExp");
 
     mspTopMzSi5394Drv = pFactory->CreateTopMzSi5394Drv();
 
-    mspFpgaPlI2c4RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus4);
+    mspFpgaPlI2c4RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus4), REG_BUS_PL_I2C4, "I2c4");
 
-    mspFpgaPlMdioIf = pFactory->CreateFpgaPlMdioRegIf();
+    mspFpgaPlMdioIf.Attach(pFactory->CreateFpgaPlMdioRegIf(), REG_BUS_MDIO, "Mdio");
 }
 
 void BoardCommonDriver::CreateGeckoDriver()
@@ -583,28 +807,28 @@ int BoardCommonDriver::InitIoExp(boardMs::mezzBoardIdType boardId)
 {
     INFN_LOG(SeverityLevel::info) << "7. Mezz Board " << (uint32)boardId << " Configure IO Expander ...";
 
-    shared_ptr<FpgaI2cIf> spMezzIoExpIf;
+    const RegIfProbe<FpgaI2cIf>* pMezzIoExpIf = nullptr;
     if (boardId == boardMs::MEZZ_BRD_TOP)
     {
-        spMezzIoExpIf = mspTopMzIoExpIf;
+        pMezzIoExpIf = &mspTopMzIoExpIf;
     }
     else
     {
-        spMezzIoExpIf = mspBottomMzIoExpIf;
+        pMezzIoExpIf = &mspBottomMzIoExpIf;
     }
 
     int retVal = -1;
     try
     {
         // iox on Mezz - write 0 to registers 4,5,6
-        spMezzIoExpIf->Write8(0x4, 0x0);
-        spMezzIoExpIf->Write8(0x5, 0x0);
-        spMezzIoExpIf->Write8(0x6, 0x0);
+        pMezzIoExpIf->Write8(0x4, 0x0);
+        pMezzIoExpIf->Write8(0x5, 0x0);
+        pMezzIoExpIf->Write8(0x6, 0x0);
 
         // iox on Mezz - write c=3e, d=fc, e=e0
-        spMezzIoExpIf->Write8(0xc, 0x3e);
-        spMezzIoExpIf->Write8(0xd, 0xfc);
-        spMezzIoExpIf->Write8(0xe, 0xe0);
+        pMezzIoExpIf->Write8(0xc, 0x3e);
+        pMezzIoExpIf->Write8(0xd, 0xfc);
+        pMezzIoExpIf->Write8(0xe, 0xe0);
 
         retVal = 0;
     }
@@ -628,35 +852,63 @@ int BoardCommonDriver::InitClock(boardMs::mezzBoardIdType boardId)
 {
     INFN_LOG(SeverityLevel::info) << "8.  Mezz Board " << (uint32)boardId << " Configure Si5394 clock ...";
 
-    shared_ptr<FpgaI2cIf> spMezzIoExpIf;
+    const RegIfProbe<FpgaI2cIf>* pMezzIoExpIf = nullptr;
     shared_ptr<Si5394>    spMezzSiDrvIf;
     if (boardId == boardMs::MEZZ_BRD_TOP)
     {
-        spMezzIoExpIf = mspTopMzIoExpIf;
+        pMezzIoExpIf = &mspTopMzIoExpIf;
         spMezzSiDrvIf = mspTopMzSi5394Drv;
     }
     else
     {
-        spMezzIoExpIf = mspBottomMzIoExpIf;
+        pMezzIoExpIf = &mspBottomMzIoExpIf;
         spMezzSiDrvIf = mspBottomMzSi5394Drv;
     }
 
+    // Si5394 shares the mezz bus with the IO expander; the driver is not a probe
+    RegBusType siBus = pMezzIoExpIf->GetBus();
+
     int retVal = -1;
     try
     {
         //take si5394 out of reset
-        spMezzIoExpIf->Write8(0x4, 0x1);
+        pMezzIoExpIf->Write8(0x4, 0x1);
+
+        BoardReadyWait::WaitUntilReady(cClockRstWait, [&]()
+        {
+            I2cTransaction txn(siBus);
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(cClockRstDly));
+            return ((spMezzSiDrvIf->Read(cSi5394DeviceReadyReg) & 0xFF) == cSi5394DeviceReadyVal);
+        });
 
-        uint32 regVal = spMezzSiDrvIf->Read(0x02);
+        uint32 regVal;
+        {
+            I2cTransaction txn(siBus);
+
+            regVal = spMezzSiDrvIf->Read(0x02);
+        }
         INFN_LOG(SeverityLevel::info) << "Mezz Board " << (uint32)boardId << " Si5394 Read offset 0x02 = 0x" << std::hex << regVal << std::dec;
 
-        spMezzSiDrvIf->Configure(msSi5394_RegList);
+        {
+            I2cTransaction txn(siBus);
+
+            spMezzSiDrvIf->Configure(msSi5394_RegList);
+        }
+
+        // Done calibrating and PLL locked
+        BoardReadyWait::WaitUntilReady(cClockCfgWait, [&]()
+        {
+            I2cTransaction txn(siBus);
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(cClockCfgDly));
+            return (((spMezzSiDrvIf->Read(cSi5394StatusReg) & cSi5394SysInCalMask) == 0) &&
+                    ((spMezzSiDrvIf->Read(cSi5394LolStatusReg) & cSi5394LolMask) == 0));
+        });
 
-        spMezzSiDrvIf->ClearStatusBits();
+        {
+            I2cTransaction txn(siBus);
+
+            spMezzSiDrvIf->ClearStatusBits();
+        }
 
         retVal = 0;
     }
@@ -681,26 +933,42 @@ int BoardCommonDriver::InitBcm(boardMs::mezzBoardIdType boardId)
     INFN_LOG(SeverityLevel::info) << "9. Mezz Board " << (uint32)boardId
         << " Take Gearbox out of reset write IOX 0x04=C1, 5=0x01 ...";
 
-    shared_ptr<FpgaI2cIf> spMezzIoExpIf;
+    const RegIfProbe<FpgaI2cIf>* pMezzIoExpIf = nullptr;
     uint32    mezzMdioBusId;
     if (boardId == boardMs::MEZZ_BRD_TOP)
     {
-        spMezzIoExpIf  = mspTopMzIoExpIf;
+        pMezzIoExpIf  = &mspTopMzIoExpIf;
         mezzMdioBusId = cTopMezzMdioBus;
     }
     else
     {
-        spMezzIoExpIf  = mspBottomMzIoExpIf;
+        pMezzIoExpIf  = &mspBottomMzIoExpIf;
         mezzMdioBusId = cBottomMezzMdioBus;
     }
 
     int retVal = -1;
     try
     {
-        spMezzIoExpIf->Write8(0x4, 0xC1);
-        spMezzIoExpIf->Write8(0x5, 0x01);
+        pMezzIoExpIf->Write8(0x4, 0xC1);
+        pMezzIoExpIf->Write8(0x5, 0x01);
+
+        // All three gearboxes answer on MDIO
+        BoardReadyWait::WaitUntilReady(cGbResetWait, [&]()
+        {
+            std::lock_guard<std::mutex> guard(mMdioLock);
 
-        sleep(cGbResetDelayTime);
+            const uint32 mdioAddrs[] = { cBCM81725_1MdioAddress, cBCM81725_2MdioAddress, cBCM81725_3MdioAddress };
+
+            for (uint32 mdioAddr : mdioAddrs)
+            {
+                if (mspFpgaPlMdioIf->Read16(mezzMdioBusId, mdioAddr, cBCM81725PortIdOffset) == 0xFFFF)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        });
 
         INFN_LOG(SeverityLevel::info) << "10. Mezz Board " << (uint32)boardId << " Read mdio register from bcm#1 ...";
 
@@ -711,6 +979,9 @@ int BoardCommonDriver::InitBcm(boardMs::mezzBoardIdType boardId)
          * return: Gear box port ID
          */
 
+        // Shared MDIO controller; both mezz may be in init at once
+        std::lock_guard<std::mutex> guard(mMdioLock);
+
         uint32 data;
         data = mspFpgaPlMdioIf->Read16(mezzMdioBusId, cBCM81725_1MdioAddress, cBCM81725PortIdOffset);
         INFN_LOG(SeverityLevel::info) << "10.1. Mezz Board " << (uint32)boardId << " cBCM81725_1 port Id = 0x" << std::hex << data;
@@ -809,15 +1080,15 @@ int BoardCommonDriver::InitBcmDriver(boardMs::mezzBoardSpecType boardId)
 void BoardCommonDriver::CheckMezzPwrSeq(boardMs::mezzBoardIdType brdId)
 {
     const auto& p = RegIfFactorySingleton::Instance();
-    shared_ptr<FpgaI2cIf> spMezzPwrSeq;
+    RegIfProbe<FpgaI2cIf> spMezzPwrSeq;
 
     if (brdId == boardMs::MEZZ_BRD_TOP)
     {
-        spMezzPwrSeq = p->CreateFpgaPlI2c1VoltageSequencerRegIf();
+        spMezzPwrSeq.Attach(p->CreateFpgaPlI2c1VoltageSequencerRegIf(), REG_BUS_PL_I2C1, "I2c1VolSeq");
     }
     else
     {
-        spMezzPwrSeq = p->CreateFpgaPlI2c0VoltageSequencerRegIf();
+        spMezzPwrSeq.Attach(p->CreateFpgaPlI2c0VoltageSequencerRegIf(), REG_BUS_PL_I2C0, "I2c0VolSeq");
     }
 
     for(uint32 i = 0; i < 10; i++)
@@ -853,4 +1124,87 @@ void BoardCommonDriver::CheckMezzPwrSeq(boardMs::mezzBoardIdType brdId)
     }
 }
 
+int BoardCommonDriver::GetMezzLatch(uint32 &latchBits)
+{
+    int errCode = -1;
 
+    try
+    {
+        latchBits = mspFpgaPlMiscIf->Read32(cFpgaLatchSrcReg) &
+                    (cFpgaLatchSrcReg_mezz_power_en_mask | cFpgaLatchSrcReg_mezz_reset_l_mask);
+        errCode = 0;
+    }
+    catch (regIf::RegIfException &ex)
+    {
+        INFN_LOG(SeverityLevel::error) << "Error: Fpga Access Failed. Ex: " << ex.GetError();
+    }
+    catch(exception& ex)
+    {
+        INFN_LOG(SeverityLevel::error) << "Caught Exception: " << ex.what();
+    }
+    catch( ... )
+    {
+        INFN_LOG(SeverityLevel::error) << "Caught Exception";
+    }
+
+    return errCode;
+}
+
+// Changes with the register list built in, not with the device
+uint32 BoardCommonDriver::GetClockCfgHash()
+{
+    return BoardInitFprint::HashList(msSi5394_RegList);
+}
+
+int BoardCommonDriver::GetClockLock(boardMs::mezzBoardIdType boardId, bool &isLocked)
+{
+    shared_ptr<Si5394> spMezzSiDrvIf = (boardId == boardMs::MEZZ_BRD_TOP) ?
+                                       mspTopMzSi5394Drv : mspBottomMzSi5394Drv;
+
+    RegBusType siBus = (boardId == boardMs::MEZZ_BRD_TOP) ? REG_BUS_PL_I2C3 : REG_BUS_PL_I2C2;
+
+    try
+    {
+        I2cTransaction txn(siBus);
+
+        isLocked = (((spMezzSiDrvIf->Read(cSi5394DeviceReadyReg) & 0xFF) == cSi5394DeviceReadyVal) &&
+                    ((spMezzSiDrvIf->Read(cSi5394StatusReg) & cSi5394SysInCalMask) == 0) &&
+                    ((spMezzSiDrvIf->Read(cSi5394LolStatusReg) & cSi5394LolMask) == 0));
+    }
+    catch ( ... )
+    {
+        // Mezz power or reset changes show in the FPGA latch instead
+        return -1;
+    }
+
+    return 0;
+}
+
+int BoardCommonDriver::GetBcmFwInfo(boardMs::mezzBoardIdType boardId, uint32 &fwVer, uint32 &fwCrc)
+{
+    if (NULL == mpBcmDriver)
+    {
+        INFN_LOG(SeverityLevel::error) << "Driver not created yet!!";
+
+        return -1;
+    }
+
+    unsigned int bus = (boardId == boardMs::MEZZ_BRD_TOP) ? cTopMezzMdioBus : cBottomMezzMdioBus;
+    unsigned int ver = 0, crc = 0;
+
+    int errCode = -1;
+
+    try
+    {
+        errCode = mpBcmDriver->getFwInfo(bus, ver, crc);
+    }
+    catch ( ... )
+    {
+        INFN_LOG(SeverityLevel::error) << "Caught Exception";
+    }
+
+    fwVer = ver;
+    fwCrc = crc;
+
+    return errCode;
+}
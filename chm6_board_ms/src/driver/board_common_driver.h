@@ -24,6 +24,7 @@
 #include "RaStub.h"       // Gecko's RaStub
 
 #include "board_defs.h"
+#include "board_reg_probe.h"
 
 using namespace std;
 
@@ -55,6 +56,23 @@ public:
 
     int GetFpgaIoExpInput(boardMs::mezzBoardIdType boardId, uint32 &regVal);
 
+    // Capture misc status and the IO Expander inputs of mezzSpec in one pass
+    int GetDigitalInputSnapshot(boardMs::mezzBoardSpecType mezzSpec,
+                                boardMs::DigitalInputSnapshot &snapshot);
+
+    /*
+     * FPGA misc status interrupt, exposed through UIO
+     */
+    int OpenFaultIrq();
+
+    bool IsFaultIrqAvailable() { return (mFaultIrqFd >= 0); }
+
+    // Returns 1 on interrupt, 0 on timeout or wake, -1 on error
+    int WaitFaultIrq(uint32 timeoutMs);
+
+    // Make a blocked WaitFaultIrq return now
+    void WakeFaultIrq();
+
     // Host Board Related Inits ....
 
     int EnableMezzPower(bool isEnable);
@@ -85,6 +103,18 @@ public:
 
     void CheckMezzPwrSeq(boardMs::mezzBoardIdType brdId);
 
+    // Init fingerprint; what init left the hardware running
+
+    int GetMezzLatch(uint32 &latchBits);
+
+    static uint32 GetClockCfgHash();
+
+    // Non zero when the Si5394 cannot be read; isLocked is then unknown
+    int GetClockLock(boardMs::mezzBoardIdType boardId, bool &isLocked);
+
+    // -1 when the gearbox cannot be read, 1 when its cores run different images
+    int GetBcmFwInfo(boardMs::mezzBoardIdType boardId, uint32 &fwVer, uint32 &fwCrc);
+
 private:
 
     /*
@@ -95,48 +125,49 @@ private:
     void CreateGeckoDriver();
 
 
-    shared_ptr<RegIf> mspFpgaPlRegIf;
+    RegIfProbe<RegIf> mspFpgaPlRegIf;
 
-    shared_ptr<FpgaMiscIf> mspFpgaPlMiscIf;
+    RegIfProbe<FpgaMiscIf> mspFpgaPlMiscIf;
     /*
      * I2C[0] assigned to MEZZ I2C[0]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0RegIf;
 
     /*
      * I2C[1] assigned to MEZZ I2C[1]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1RegIf;
 
     /*
      * I2C[2] assigned to MEZZ I2C[2]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c2RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzFPC402_1RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzFPC402_2RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzIoExpIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c2RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzFPC402_1RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzFPC402_2RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzIoExpIf;
     shared_ptr<Si5394> mspBottomMzSi5394Drv;
 
     /*
      * I2C[3] assigned to MEZZ I2C[3]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c3RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzFPC402_1RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzFPC402_2RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzIoExpIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c3RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzFPC402_1RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzFPC402_2RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzIoExpIf;
     shared_ptr<Si5394> mspTopMzSi5394Drv;
 
     /*
      * I2C[4] assigned to SKICK I2C
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c4RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c4RegIf;
 
     /*
      * MDIO module contains a single driver (set of registers)
      * for up to 4 sets of MDIO interfaces or buses
      * CHM6 uses 2 sets of MDIO buses Currently
      */
-    shared_ptr<FpgaMdioIf> mspFpgaPlMdioIf;
+    RegIfProbe<FpgaMdioIf> mspFpgaPlMdioIf;
+    std::mutex mMdioLock;
 
 #ifdef ARCH_x86
     unique_ptr<gearboxsim::Bcm81725Sim> mpBcmDriver;
@@ -144,6 +175,11 @@ private:
     unique_ptr<gearbox::Bcm81725> mpBcmDriver;
 #endif
 
+    static int FindUioDev(const std::string& uioName, std::string& uioDev);
+
+    int mFaultIrqFd;
+    int mFaultIrqWakeFd;
+
     bool mIsSim;
     bool mIsEval;
 };
@@ -4,19 +4,27 @@
 //
 //-------------------------------------------------------------
 
+#include <algorithm>
 #include <bitset>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <ios>
 #include <iostream>
 #include <string>
 #include <thread>
 #include <boost/thread.hpp>
+#include <boost/crc.hpp>
 
 #include "board_driver.h"
 #include "InfnLogger.h"
 #include "EepromHdr.h"
 #include "EepromTlvArea.h"
 #include "RegIfException.h"
+#include "board_ready_wait.h"
+
+// Device image staged for the library import
+const char* cMfgEepromReadFile = "/tmp/chm6_mfg_eeprom_read.bin";
 
 BoardDriver::BoardDriver()
     : mspFpgaPlRegIf(nullptr)
@@ -51,6 +59,7 @@ BoardDriver::BoardDriver()
     , mspFpgaPlI2c4OutletTempSensorIf(nullptr)
     , mspMfgEepromDrvRegIf(nullptr)
     , mupMfgEepromDrv(nullptr)
+    , mEqptInvCache()
 
     , mspFpgaPlMdioIf(nullptr)
 
@@ -58,6 +67,8 @@ BoardDriver::BoardDriver()
     , mupBottomMezzTmp112(nullptr)
     , mupInletTmp112(nullptr)
     , mupOutletTmp112(nullptr)
+    , mupTmp112Sampler(nullptr)
+    , mupLedShadow(nullptr)
 
     , mspFpgaPsI2c0PwrSeqIf(nullptr)
 
@@ -66,10 +77,14 @@ BoardDriver::BoardDriver()
     , mColdRestartDcoDelaySec(-1)
     , mupLog(std::make_unique<SimpleLog::Log>(2000))
 {
+    RegCallerScope callerScope(REG_CALLER_INIT);
+
     CreateRegIf();
 
     mspBoardCmnDrv = make_shared<BoardCommonDriver>(false, false);
 
+    mupTmp112Sampler->Start();
+
     boost::thread(boost::bind(
             &BoardDriver::MonitorStatus, this
             )).detach();
@@ -86,14 +101,100 @@ BoardDriver::~BoardDriver()
 
 void BoardDriver::GetEqptInventory(Chm6EqptInventory& inv)
 {
-    uint8* binBuf = new uint8[cFpgaSkickMfgEepromSize];
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
+    if (mEqptInvCache.mIsValid)
+    {
+        uint32 probeCrc = 0;
+
+        if (ProbeMfgEeprom(mEqptInvCache.mTlvEnd, probeCrc))
+        {
+            // Cannot tell; a decode would not get through either
+            mEqptInvCache.mNumProbeErrs++;
+        }
+        else if (probeCrc != mEqptInvCache.mProbeCrc)
+        {
+            INFN_LOG(SeverityLevel::info) << "MFG EEPROM contents changed, decoding inventory again";
+
+            mEqptInvCache.mIsValid = false;
+        }
+
+        if (mEqptInvCache.mIsValid)
+        {
+            mEqptInvCache.mNumHits++;
+
+            inv = mEqptInvCache.mInv;
+            return;
+        }
+    }
+
+    if (DecodeEqptInventory(mEqptInvCache.mInv, mEqptInvCache.mTlvEnd, mEqptInvCache.mProbeCrc))
+    {
+        // Last decode, if any, is all there is
+        mEqptInvCache.mNumProbeErrs++;
+        mEqptInvCache.mIsValid = false;
+
+        inv = mEqptInvCache.mInv;
+        return;
+    }
 
-    mupMfgEepromDrv->GetEepromBin(binBuf);
+    mEqptInvCache.mNumDecodes++;
+    mEqptInvCache.mIsValid = true;
+
+    inv = mEqptInvCache.mInv;
+}
+
+/*
+ * Bytes the change probe covers: the leading header fields and the stored
+ * CRC that ends the TLV area, which any TLV edit rewrites. A blank or
+ * corrupt header gives no sane TLV end, so only the header is covered then.
+ */
+static void GetMfgEepromProbeOffsets(uint32 tlvEnd, std::vector<uint32>& vOffsets)
+{
+    vOffsets.clear();
+
+    for (uint32 offset = 0; offset < cMfgEepromProbeHdrLen; offset++)
+    {
+        vOffsets.push_back(offset);
+    }
+
+    if ((tlvEnd >= cMfgEepromProbeHdrLen + cMfgEepromProbeTlvCrcLen) &&
+        (tlvEnd <= cFpgaSkickMfgEepromSize))
+    {
+        for (uint32 offset = tlvEnd - cMfgEepromProbeTlvCrcLen; offset < tlvEnd; offset++)
+        {
+            vOffsets.push_back(offset);
+        }
+    }
+}
+
+int BoardDriver::DecodeEqptInventory(Chm6EqptInventory& inv, uint32& tlvEnd, uint32& probeCrc)
+{
+    std::vector<uint8> vBinBuf(cFpgaSkickMfgEepromSize);
+    uint8* binBuf = vBinBuf.data();
+
+    if (ReadMfgEepromImage(vBinBuf))
+    {
+        return -1;
+    }
 
     // Parse
     EepromHdr eepromHdr;
     eepromHdr.DecodeBuffer(binBuf, cFpgaSkickMfgEepromSize);
 
+    // Probe CRC from the image just read, over the bytes ProbeMfgEeprom reads
+    tlvEnd = eepromHdr.GetTlvEndOffset();
+
+    std::vector<uint32> vOffsets;
+    GetMfgEepromProbeOffsets(tlvEnd, vOffsets);
+
+    boost::crc_32_type crc32;
+    for (uint32 offset : vOffsets)
+    {
+        crc32.process_byte(binBuf[offset]);
+    }
+    probeCrc = crc32.checksum();
+
     EepromTlvArea eepromTlvArea;
     eepromTlvArea.DecodeBuffer(binBuf + eepromHdr.GetTlvStartOffset(),
             eepromHdr.GetTlvEndOffset() - eepromHdr.GetTlvStartOffset());
@@ -161,7 +262,59 @@ void BoardDriver::GetEqptInventory(Chm6EqptInventory& inv)
 
     inv.InsertionDate = std::string("Not available");
 
-    delete[] binBuf;
+    return 0;
+}
+
+int BoardDriver::ProbeMfgEeprom(uint32 tlvEnd, uint32& crc)
+{
+    std::vector<uint32> vOffsets;
+    GetMfgEepromProbeOffsets(tlvEnd, vOffsets);
+
+    boost::crc_32_type crc32;
+
+    try
+    {
+        // One bus grant per byte so fault reads get in between
+        for (uint32 offset : vOffsets)
+        {
+            uint8 data = mspMfgEepromDrvRegIf->Read8(offset);
+
+            crc32.process_byte(data);
+        }
+    }
+    catch (regIf::RegIfException &ex)
+    {
+        INFN_LOG(SeverityLevel::debug) << "MFG EEPROM probe failed. Ex: " << ex.GetError();
+        return -1;
+    }
+    catch ( ... )
+    {
+        INFN_LOG(SeverityLevel::debug) << "MFG EEPROM probe failed";
+        return -1;
+    }
+
+    crc = crc32.checksum();
+
+    return 0;
+}
+
+void BoardDriver::InvalidateEqptInventory()
+{
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
+    mEqptInvCache.mIsValid = false;
+}
+
+void BoardDriver::DumpEqptInvCache(std::ostream& out)
+{
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
+    out << "Inventory cache valid: " << mEqptInvCache.mIsValid
+        << " decodes: " << mEqptInvCache.mNumDecodes
+        << " hits: " << mEqptInvCache.mNumHits
+        << " probe errors: " << mEqptInvCache.mNumProbeErrs
+        << " TLV end: " << mEqptInvCache.mTlvEnd
+        << " crc: 0x" << std::hex << mEqptInvCache.mProbeCrc << std::dec << std::endl;
 }
 
 /*
@@ -210,8 +363,6 @@ int BoardDriver::LedLocationTest(bool doTest)
 
 int BoardDriver::SetFruFaultLedState(LedStateType ledState)
 {
-    INFN_LOG(SeverityLevel::info) << "BoardDriver::SetFruFaultLedState() ...";
-
     std::lock_guard<std::mutex> guard(mFruFaultLedLock);
 
     bool isValidColor = false;
@@ -250,10 +401,7 @@ int BoardDriver::SetFruFaultLedState(LedStateType ledState)
 
     try
     {
-        uint32 data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= ~mask;
-        data |= (colorBits << regBitPos);
-        mspFpgaPlMiscIf->Write32(regOffset, data);
+        mupLedShadow->WriteField(regOffset, mask, (colorBits << regBitPos));
     }
     catch ( regIf::RegIfException &e )
     {
@@ -261,12 +409,10 @@ int BoardDriver::SetFruFaultLedState(LedStateType ledState)
         return -1;
     }
 
-    INFN_LOG(SeverityLevel::info) << "Set Fru FAULT LED to " << boardMs::LedStateTypeToStr(ledState);
+    BRD_TRACE(mTrace, "Set Fru FAULT LED to %d regOffset: 0x%x regBitPos: %d colorBits: 0x%x",
+              ledState, regOffset, regBitPos, colorBits);
 
-    INFN_LOG(SeverityLevel::info) << "regOffset: 0x" << std::hex << regOffset << std::dec
-                   << " mask: 0b" << std::bitset<32>(mask)
-                   << " regBitPos: " << std::dec << regBitPos
-                   << " colorBits: 0b" << std::bitset<3>(colorBits);
+    INFN_LOG(SeverityLevel::debug) << "Set Fru FAULT LED to " << boardMs::LedStateTypeToStr(ledState);
 
     return 0;
 }
@@ -284,8 +430,7 @@ int BoardDriver::GetFruFaultLedState(LedStateType& ledState)
     uint32 data = 0;
     try
     {
-        data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= mask;
+        data = mupLedShadow->ReadField(regOffset, mask);
         data >>= regBitPos;
     }
     catch ( regIf::RegIfException &e )
@@ -314,8 +459,6 @@ int BoardDriver::GetFruFaultLedState(LedStateType& ledState)
 
 int BoardDriver::SetFruActiveLedState(LedStateType ledState)
 {
-    INFN_LOG(SeverityLevel::info) << "BoardDriver::SetFruActiveLedState() ...";
-
     std::lock_guard<std::mutex> guard(mFruActiveLedLock);
 
     bool isValidColor = false;
@@ -362,10 +505,7 @@ int BoardDriver::SetFruActiveLedState(LedStateType ledState)
 
     try
     {
-        uint32 data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= ~mask;
-        data |= (colorBits << regBitPos);
-        mspFpgaPlMiscIf->Write32(regOffset, data);
+        mupLedShadow->WriteField(regOffset, mask, (colorBits << regBitPos));
     }
     catch ( regIf::RegIfException &e )
     {
@@ -373,12 +513,10 @@ int BoardDriver::SetFruActiveLedState(LedStateType ledState)
         return -1;
     }
 
-    INFN_LOG(SeverityLevel::info) << "Set Fru ACTIVE LED to " << boardMs::LedStateTypeToStr(ledState);
+    BRD_TRACE(mTrace, "Set Fru ACTIVE LED to %d regOffset: 0x%x regBitPos: %d colorBits: 0x%x",
+              ledState, regOffset, regBitPos, colorBits);
 
-    INFN_LOG(SeverityLevel::info) << "regOffset: 0x" << std::hex << regOffset << std::dec
-                   << " mask: 0b" << std::bitset<32>(mask)
-                   << " regBitPos: " << std::dec << regBitPos
-                   << " colorBits: 0b" << std::bitset<3>(colorBits);
+    INFN_LOG(SeverityLevel::debug) << "Set Fru ACTIVE LED to " << boardMs::LedStateTypeToStr(ledState);
 
     return 0;
 }
@@ -396,8 +534,7 @@ int BoardDriver::GetFruActiveLedState(LedStateType& ledState)
     uint32 data = 0;
     try
     {
-        data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= mask;
+        data = mupLedShadow->ReadField(regOffset, mask);
         data >>= regBitPos;
     }
     catch ( regIf::RegIfException &e )
@@ -437,74 +574,15 @@ int BoardDriver::GetFruActiveLedState(LedStateType& ledState)
  */
 int BoardDriver::SetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, LedStateType ledState)
 {
-    INFN_LOG(SeverityLevel::info) << "BoardDriver::SetMezzQsfpLedState() ...";
-
     std::lock_guard<std::mutex> guard(mQsfgLedLock);
 
-    bool isValidColor = false;
     uint32 colorBits = 0b000;
 
-    if (ledType == QSFP_ACTIVE)
+    if (!QsfpLedStateToBits(ledType, ledState, colorBits))
     {
-        switch(ledState)
-        {
-            case GREEN:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_SOLID_GREEN_bits;
-                break;
-            case FLASHING_GREEN:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_FLASHING_GREEN_bits;
-                break;
-            case YELLOW:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_SOLID_YELLOW_bits;
-                break;
-            case FLASHING_YELLOW:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_FLASHING_YELLOW_bits;
-                break;
-            case OFF:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_OFF_bits;
-                break;
-            default:
-                isValidColor = false;
-                break;
-        }
-
-        if (!isValidColor)
-        {
-            INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzQSFPLedState(): invalid QSFP ACTIVE LED state: " << boardMs::LedStateTypeToStr(ledState) << std::endl;
-            return -1;
-        }
-    }
-    else if (ledType == QSFP_LOS)
-    {
-        switch(ledState)
-        {
-            case RED:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_SOLID_RED_bits;
-                break;
-            case FLASHING_RED:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_FLASHING_RED_bits;
-                break;
-            case OFF:
-                isValidColor = true;
-                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_OFF_bits;
-                break;
-            default:
-                isValidColor = false;
-                break;
-        }
-
-        if (!isValidColor)
-        {
-            INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzQSFPLedState(): invalid QSFP LOS LED state: " << boardMs::LedStateTypeToStr(ledState) << std::endl;
-            return -1;
-        }
+        INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzQSFPLedState(): invalid " << boardMs::QSFPLedTypeToStr(ledType)
+                                         << " LED state: " << boardMs::LedStateTypeToStr(ledState);
+        return -1;
     }
 
     uint32 regOffset = boardMs::cFpgaLedReg_QSFP_LED_Addr[ledType][portId];
@@ -515,10 +593,7 @@ int BoardDriver::SetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, Led
 
     try
     {
-        uint32 data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= ~mask;
-        data |= (colorBits << regBitPos);
-        mspFpgaPlMiscIf->Write32(regOffset, data);
+        mupLedShadow->WriteField(regOffset, mask, (colorBits << regBitPos));
     }
     catch ( regIf::RegIfException &e )
     {
@@ -526,16 +601,14 @@ int BoardDriver::SetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, Led
         return -1;
     }
 
-    INFN_LOG(SeverityLevel::info) << "Set QSFP LED on "
+    BRD_TRACE(mTrace, "Set QSFP LED on port %d type %d to %d regOffset: 0x%x",
+              portId, ledType, ledState, regOffset);
+
+    INFN_LOG(SeverityLevel::debug) << "Set QSFP LED on "
                    << boardMs::QSFPPortIdToStr(portId)   << " "
                    << boardMs::QSFPLedTypeToStr(ledType) << " "
                    << " to " << boardMs::LedStateTypeToStr(ledState);
 
-    INFN_LOG(SeverityLevel::info) << "regOffset: 0x" << std::hex << regOffset << std::dec
-                   << " mask: 0b" << std::bitset<32>(mask)
-                   << " regBitPos: " << std::dec << regBitPos
-                   << " colorBits: 0b" << std::bitset<3>(colorBits);
-
     return 0;
 }
 
@@ -553,8 +626,7 @@ int BoardDriver::GetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, Led
 
     try
     {
-        data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= mask;
+        data = mupLedShadow->ReadField(regOffset, mask);
         data >>= regBitPos;
     }
     catch ( regIf::RegIfException &e )
@@ -563,44 +635,7 @@ int BoardDriver::GetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, Led
         return -1;
     }
 
-    if (ledType == QSFP_ACTIVE)
-    {
-        if (data == cFpgaLedReg_QSFP_ACTIVE_SOLID_GREEN_bits)
-        {
-            ledState = GREEN;
-        }
-        else if (data == cFpgaLedReg_QSFP_ACTIVE_FLASHING_GREEN_bits)
-        {
-            ledState = FLASHING_GREEN;
-        }
-        else if (data == cFpgaLedReg_QSFP_ACTIVE_SOLID_YELLOW_bits)
-        {
-            ledState = YELLOW;
-        }
-        else if (data == cFpgaLedReg_QSFP_ACTIVE_FLASHING_YELLOW_bits)
-        {
-            ledState = FLASHING_YELLOW;
-        }
-        else
-        {
-            ledState = OFF;
-        }
-    }
-    else if (ledType == QSFP_LOS)
-    {
-        if (data == cFpgaLedReg_QSFP_LOS_SOLID_RED_bits)
-        {
-            ledState = RED;
-        }
-        else if (data == cFpgaLedReg_QSFP_LOS_FLASHING_RED_bits)
-        {
-            ledState = FLASHING_RED;
-        }
-        else
-        {
-            ledState = OFF;
-        }
-    }
+    ledState = QsfpLedBitsToState(ledType, data);
 
 //    INFN_LOG(SeverityLevel::info) << "Get QSFP LED on "
 //                   << boardMs::QSFPPortIdToStr(portId)   << " "
@@ -615,12 +650,137 @@ int BoardDriver::GetMezzQsfpLedState(QSFPPortId portId, QSFPLedType ledType, Led
  */
 int BoardDriver::SetMezzLineLedState(LineId lineId, LineLedType ledType, LedStateType ledState)
 {
-    INFN_LOG(SeverityLevel::info) << "BoardDriver::SetMezzLineLedState() ...";
+    std::lock_guard<std::mutex> guard(mLineLedLock);
+
+    uint32 colorBits = 0b000;
+
+    if (!LineLedStateToBits(ledType, ledState, colorBits))
+    {
+        INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzLINELedState(): invalid " << boardMs::LINELedTypeToStr(ledType)
+                                         << " LED state: " << boardMs::LedStateTypeToStr(ledState);
+        return -1;
+    }
+
+    uint32 regOffset = boardMs::cFpgaLedReg_LINE_LED_Addr[ledType][lineId];
+
+    uint32 mask = boardMs::cFpgaLedReg_LINE_mask[ledType][lineId];
+
+    uint32 regBitPos = boardMs::cFpgaLedReg_LINE_bitpos[ledType][lineId];
 
+    try
+    {
+        mupLedShadow->WriteField(regOffset, mask, (colorBits << regBitPos));
+    }
+    catch ( regIf::RegIfException &e )
+    {
+        INFN_LOG(SeverityLevel::error) << "Error: Process LINE LED failed! Ex: " << e.GetError();
+        return -1;
+    }
+
+    BRD_TRACE(mTrace, "Set LINE LED on line %d type %d to %d regOffset: 0x%x",
+              lineId, ledType, ledState, regOffset);
+
+    INFN_LOG(SeverityLevel::debug) << "Set LINE LED on "
+                   << boardMs::LineIdToStr(lineId)   << " "
+                   << boardMs::LINELedTypeToStr(ledType) << " "
+                   << " to " << boardMs::LedStateTypeToStr(ledState);
+
+    return 0;
+}
+
+int BoardDriver::GetMezzLineLedState(LineId lineId, LineLedType ledType, LedStateType& ledState)
+{
     std::lock_guard<std::mutex> guard(mLineLedLock);
 
+    uint32 regOffset = boardMs::cFpgaLedReg_LINE_LED_Addr[ledType][lineId];
+
+    uint32 mask = boardMs::cFpgaLedReg_LINE_mask[ledType][lineId];
+
+    uint32 regBitPos = boardMs::cFpgaLedReg_LINE_bitpos[ledType][lineId];
+
+    uint32 data = 0;
+    try
+    {
+        data = mupLedShadow->ReadField(regOffset, mask);
+        data >>= regBitPos;
+    }
+    catch ( regIf::RegIfException &e )
+    {
+        INFN_LOG(SeverityLevel::error) << "Error: Process LINE LED failed! Ex: " << e.GetError();
+        return -1;
+    }
+
+    ledState = LineLedBitsToState(ledType, data);
+
+//    INFN_LOG(SeverityLevel::info) << "Get LINE LED on "
+//                   << boardMs::LineIdToStr(lineId) << " "
+//                   << boardMs::LINELedTypeToStr(ledType)   << " "
+//                   << " state is: " << boardMs::LedStateTypeToStr(ledState);
+
+    return 0;
+}
+
+bool BoardDriver::QsfpLedStateToBits(QSFPLedType ledType, LedStateType ledState, uint32& colorBits)
+{
+    bool isValidColor = false;
+
+    if (ledType == QSFP_ACTIVE)
+    {
+        switch(ledState)
+        {
+            case GREEN:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_SOLID_GREEN_bits;
+                break;
+            case FLASHING_GREEN:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_FLASHING_GREEN_bits;
+                break;
+            case YELLOW:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_SOLID_YELLOW_bits;
+                break;
+            case FLASHING_YELLOW:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_FLASHING_YELLOW_bits;
+                break;
+            case OFF:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_ACTIVE_OFF_bits;
+                break;
+            default:
+                isValidColor = false;
+                break;
+        }
+    }
+    else if (ledType == QSFP_LOS)
+    {
+        switch(ledState)
+        {
+            case RED:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_SOLID_RED_bits;
+                break;
+            case FLASHING_RED:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_FLASHING_RED_bits;
+                break;
+            case OFF:
+                isValidColor = true;
+                colorBits = boardMs::cFpgaLedReg_QSFP_LOS_OFF_bits;
+                break;
+            default:
+                isValidColor = false;
+                break;
+        }
+    }
+
+    return isValidColor;
+}
+
+bool BoardDriver::LineLedStateToBits(LineLedType ledType, LedStateType ledState, uint32& colorBits)
+{
     bool isValidColor = false;
-    uint32 colorBits = 0b000;
 
     if (ledType == LINE_ACTIVE)
     {
@@ -650,12 +810,6 @@ int BoardDriver::SetMezzLineLedState(LineId lineId, LineLedType ledType, LedStat
                 isValidColor = false;
                 break;
         }
-
-        if (!isValidColor)
-        {
-            INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzLINELedState(): invalid LINE ACTIVE LED state: " << boardMs::LedStateTypeToStr(ledState) << std::endl;
-            return -1;
-        }
     }
     else if (ledType == LINE_LOS)
     {
@@ -677,114 +831,290 @@ int BoardDriver::SetMezzLineLedState(LineId lineId, LineLedType ledType, LedStat
                 isValidColor = false;
                 break;
         }
+    }
+
+    return isValidColor;
+}
+
+LedStateType BoardDriver::QsfpLedBitsToState(QSFPLedType ledType, uint32 data)
+{
+    LedStateType ledState = OFF;
 
-        if (!isValidColor)
+    if (ledType == QSFP_ACTIVE)
+    {
+        if (data == cFpgaLedReg_QSFP_ACTIVE_SOLID_GREEN_bits)
         {
-            INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzLINELedState(): invalid LINE LOS LED state: " << boardMs::LedStateTypeToStr(ledState) << std::endl;
-            return -1;
+            ledState = GREEN;
+        }
+        else if (data == cFpgaLedReg_QSFP_ACTIVE_FLASHING_GREEN_bits)
+        {
+            ledState = FLASHING_GREEN;
+        }
+        else if (data == cFpgaLedReg_QSFP_ACTIVE_SOLID_YELLOW_bits)
+        {
+            ledState = YELLOW;
+        }
+        else if (data == cFpgaLedReg_QSFP_ACTIVE_FLASHING_YELLOW_bits)
+        {
+            ledState = FLASHING_YELLOW;
+        }
+        else
+        {
+            ledState = OFF;
+        }
+    }
+    else if (ledType == QSFP_LOS)
+    {
+        if (data == cFpgaLedReg_QSFP_LOS_SOLID_RED_bits)
+        {
+            ledState = RED;
+        }
+        else if (data == cFpgaLedReg_QSFP_LOS_FLASHING_RED_bits)
+        {
+            ledState = FLASHING_RED;
+        }
+        else
+        {
+            ledState = OFF;
         }
     }
 
-    uint32 regOffset = boardMs::cFpgaLedReg_LINE_LED_Addr[ledType][lineId];
+    return ledState;
+}
 
-    uint32 mask = boardMs::cFpgaLedReg_LINE_mask[ledType][lineId];
+LedStateType BoardDriver::LineLedBitsToState(LineLedType ledType, uint32 data)
+{
+    LedStateType ledState = OFF;
 
-    uint32 regBitPos = boardMs::cFpgaLedReg_LINE_bitpos[ledType][lineId];
+    if (ledType == LINE_ACTIVE)
+    {
+        if (data == cFpgaLedReg_LINE_ACTIVE_SOLID_GREEN_bits)
+        {
+            ledState = GREEN;
+        }
+        else if (data == cFpgaLedReg_LINE_ACTIVE_FLASHING_GREEN_bits)
+        {
+            ledState = FLASHING_GREEN;
+        }
+        else if (data == cFpgaLedReg_LINE_ACTIVE_SOLID_YELLOW_bits)
+        {
+            ledState = YELLOW;
+        }
+        else if (data == cFpgaLedReg_LINE_ACTIVE_FLASHING_YELLOW_bits)
+        {
+            ledState = FLASHING_YELLOW;
+        }
+        else
+        {
+            ledState = OFF;
+        }
+    }
+    else if (ledType == LINE_LOS)
+    {
+        if (data == cFpgaLedReg_LINE_LOS_SOLID_RED_bits)
+        {
+            ledState = RED;
+        }
+        else if (data == cFpgaLedReg_LINE_LOS_FLASHING_RED_bits)
+        {
+            ledState = FLASHING_RED;
+        }
+        else
+        {
+            ledState = OFF;
+        }
+    }
+
+    return ledState;
+}
+
+/*
+ * All QSFP and line LEDs in one pass: each distinct LED register is read
+ * once and every LED is decoded from it through the table built by
+ * BuildLedDecodeTable(). The register values come from one shadow
+ * snapshot, so no per type LED lock is needed.
+ */
+int BoardDriver::GetMezzLedStates(MezzLedStates& ledStates)
+{
+    std::vector<uint32> regValues;
 
     try
     {
-        uint32 data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= ~mask;
-        data |= (colorBits << regBitPos);
-        mspFpgaPlMiscIf->Write32(regOffset, data);
+        mupLedShadow->ReadRegs(mvLedRegOffsets, regValues);
     }
     catch ( regIf::RegIfException &e )
     {
-        INFN_LOG(SeverityLevel::error) << "Error: Process LINE LED failed! Ex: " << e.GetError();
+        INFN_LOG(SeverityLevel::error) << "Error: Process MEZZ LEDs failed! Ex: " << e.GetError();
         return -1;
     }
 
-    INFN_LOG(SeverityLevel::info) << "Set LINE LED on "
-                   << boardMs::LineIdToStr(lineId)   << " "
-                   << boardMs::LINELedTypeToStr(ledType) << " "
-                   << " to " << boardMs::LedStateTypeToStr(ledState);
+    for (uint32 type = 0; type < MAX_QSFP_LED_TYPE; type++)
+    {
+        for (uint32 i = 0; i < MAX_QSFP_NUM; i++)
+        {
+            const LedDecodeEntry& entry = maQsfpLedDecode[type][i];
 
-    INFN_LOG(SeverityLevel::info) << "regOffset: 0x" << std::hex << regOffset << std::dec
-                   << " mask: 0b" << std::bitset<32>(mask)
-                   << " regBitPos: " << std::dec << regBitPos
-                   << " colorBits: 0b" << std::bitset<3>(colorBits);
+            uint32 data = (regValues[entry.mRegIdx] & entry.mMask) >> entry.mShift;
+
+            ledStates.maQsfpLedStates[type][i] = QsfpLedBitsToState(QSFPLedType(type), data);
+        }
+    }
+
+    for (uint32 type = 0; type < MAX_LINE_LED_TYPE; type++)
+    {
+        for (uint32 i = 0; i < MAX_LINE_NUM; i++)
+        {
+            const LedDecodeEntry& entry = maLineLedDecode[type][i];
+
+            uint32 data = (regValues[entry.mRegIdx] & entry.mMask) >> entry.mShift;
+
+            ledStates.maLineLedStates[type][i] = LineLedBitsToState(LineLedType(type), data);
+        }
+    }
 
     return 0;
 }
 
-int BoardDriver::GetMezzLineLedState(LineId lineId, LineLedType ledType, LedStateType& ledState)
+/*
+ * Applies all QSFP and line LEDs not left at LED_STATE_UNKNOWN as one
+ * batch: the new register images are built from the shadow and each
+ * changed register is written once. An LED with a state invalid for it
+ * is skipped and the batch returns -1.
+ */
+int BoardDriver::SetMezzLedStates(const MezzLedStates& ledStates)
 {
-    std::lock_guard<std::mutex> guard(mLineLedLock);
+    int ret = 0;
+
+    std::vector<LedRegShadow::FieldWrite> fields;
+
+    for (uint32 type = 0; type < MAX_QSFP_LED_TYPE; type++)
+    {
+        for (uint32 i = 0; i < MAX_QSFP_NUM; i++)
+        {
+            LedStateType ledState = ledStates.maQsfpLedStates[type][i];
+
+            if (ledState == LED_STATE_UNKNOWN)
+            {
+                continue;
+            }
+
+            uint32 colorBits = 0b000;
+
+            if (!QsfpLedStateToBits(QSFPLedType(type), ledState, colorBits))
+            {
+                INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzLedStates(): invalid " << boardMs::QSFPLedTypeToStr(QSFPLedType(type))
+                                                 << " LED state on " << boardMs::QSFPPortIdToStr(QSFPPortId(i))
+                                                 << ": " << boardMs::LedStateTypeToStr(ledState);
+                ret = -1;
+                continue;
+            }
+
+            const LedDecodeEntry& entry = maQsfpLedDecode[type][i];
+
+            fields.push_back({mvLedRegOffsets[entry.mRegIdx], entry.mMask, (colorBits << entry.mShift)});
+        }
+    }
+
+    uint32 numQsfpLeds = fields.size();
+
+    for (uint32 type = 0; type < MAX_LINE_LED_TYPE; type++)
+    {
+        for (uint32 i = 0; i < MAX_LINE_NUM; i++)
+        {
+            LedStateType ledState = ledStates.maLineLedStates[type][i];
+
+            if (ledState == LED_STATE_UNKNOWN)
+            {
+                continue;
+            }
+
+            uint32 colorBits = 0b000;
+
+            if (!LineLedStateToBits(LineLedType(type), ledState, colorBits))
+            {
+                INFN_LOG(SeverityLevel::warning) << "BoardDriver::SetMezzLedStates(): invalid " << boardMs::LINELedTypeToStr(LineLedType(type))
+                                                 << " LED state on " << boardMs::LineIdToStr(LineId(i))
+                                                 << ": " << boardMs::LedStateTypeToStr(ledState);
+                ret = -1;
+                continue;
+            }
+
+            const LedDecodeEntry& entry = maLineLedDecode[type][i];
 
-    uint32 regOffset = boardMs::cFpgaLedReg_LINE_LED_Addr[ledType][lineId];
+            fields.push_back({mvLedRegOffsets[entry.mRegIdx], entry.mMask, (colorBits << entry.mShift)});
+        }
+    }
 
-    uint32 mask = boardMs::cFpgaLedReg_LINE_mask[ledType][lineId];
+    uint32 numLineLeds = fields.size() - numQsfpLeds;
 
-    uint32 regBitPos = boardMs::cFpgaLedReg_LINE_bitpos[ledType][lineId];
+    uint32 numRegWrites = 0;
 
-    uint32 data = 0;
     try
     {
-        data = mspFpgaPlMiscIf->Read32(regOffset);
-        data &= mask;
-        data >>= regBitPos;
+        numRegWrites = mupLedShadow->WriteFields(fields);
     }
     catch ( regIf::RegIfException &e )
     {
-        INFN_LOG(SeverityLevel::error) << "Error: Process LINE LED failed! Ex: " << e.GetError();
+        INFN_LOG(SeverityLevel::error) << "Error: Process MEZZ LEDs failed! Ex: " << e.GetError();
         return -1;
     }
 
-    if (ledType == LINE_ACTIVE)
+    BRD_TRACE(mTrace, "Set MEZZ LEDs qsfp: %d line: %d regWrites: %d",
+              numQsfpLeds, numLineLeds, numRegWrites);
+
+    INFN_LOG(SeverityLevel::debug) << "Set MEZZ LEDs: " << numQsfpLeds << " QSFP, "
+                                   << numLineLeds << " LINE, "
+                                   << numRegWrites << " register writes";
+
+    return ret;
+}
+
+uint32 BoardDriver::AddLedDecodeReg(uint32 regOffset)
+{
+    for (uint32 i = 0; i < mvLedRegOffsets.size(); i++)
     {
-        if (data == cFpgaLedReg_LINE_ACTIVE_SOLID_GREEN_bits)
-        {
-            ledState = GREEN;
-        }
-        else if (data == cFpgaLedReg_LINE_ACTIVE_FLASHING_GREEN_bits)
-        {
-            ledState = FLASHING_GREEN;
-        }
-        else if (data == cFpgaLedReg_LINE_ACTIVE_SOLID_YELLOW_bits)
-        {
-            ledState = YELLOW;
-        }
-        else if (data == cFpgaLedReg_LINE_ACTIVE_FLASHING_YELLOW_bits)
-        {
-            ledState = FLASHING_YELLOW;
-        }
-        else
+        if (mvLedRegOffsets[i] == regOffset)
         {
-            ledState = OFF;
+            return i;
         }
     }
-    else if (ledType == LINE_LOS)
+
+    mvLedRegOffsets.push_back(regOffset);
+
+    return (mvLedRegOffsets.size() - 1);
+}
+
+void BoardDriver::BuildLedDecodeTable()
+{
+    mvLedRegOffsets.clear();
+
+    for (uint32 type = 0; type < MAX_QSFP_LED_TYPE; type++)
     {
-        if (data == cFpgaLedReg_LINE_LOS_SOLID_RED_bits)
-        {
-            ledState = RED;
-        }
-        else if (data == cFpgaLedReg_LINE_LOS_FLASHING_RED_bits)
-        {
-            ledState = FLASHING_RED;
-        }
-        else
+        for (uint32 i = 0; i < MAX_QSFP_NUM; i++)
         {
-            ledState = OFF;
+            LedDecodeEntry& entry = maQsfpLedDecode[type][i];
+
+            entry.mRegIdx = AddLedDecodeReg(cFpgaLedReg_QSFP_LED_Addr[type][i]);
+            entry.mMask   = cFpgaLedReg_QSFP_mask[type][i];
+            entry.mShift  = cFpgaLedReg_QSFP_bitpos[type][i];
+
+            mupLedShadow->AddField(cFpgaLedReg_QSFP_LED_Addr[type][i], entry.mMask);
         }
     }
 
-//    INFN_LOG(SeverityLevel::info) << "Get LINE LED on "
-//                   << boardMs::LineIdToStr(lineId) << " "
-//                   << boardMs::LINELedTypeToStr(ledType)   << " "
-//                   << " state is: " << boardMs::LedStateTypeToStr(ledState);
+    for (uint32 type = 0; type < MAX_LINE_LED_TYPE; type++)
+    {
+        for (uint32 i = 0; i < MAX_LINE_NUM; i++)
+        {
+            LedDecodeEntry& entry = maLineLedDecode[type][i];
 
-    return 0;
+            entry.mRegIdx = AddLedDecodeReg(cFpgaLedReg_LINE_LED_Addr[type][i]);
+            entry.mMask   = cFpgaLedReg_LINE_mask[type][i];
+            entry.mShift  = cFpgaLedReg_LINE_bitpos[type][i];
+
+            mupLedShadow->AddField(cFpgaLedReg_LINE_LED_Addr[type][i], entry.mMask);
+        }
+    }
 }
 
 /*
@@ -900,20 +1230,29 @@ void BoardDriver::UpdateHwStatusToFDR()
     INFN_LOG(SeverityLevel::info) << "BoardDriver::UpdateHwStatusToFDR() ...";
 }
 
-float32 BoardDriver::GetPm(BoardPmId id)
+bool BoardDriver::GetPm(BoardPmId id, float32& value)
 {
-    float32 data = 0;
+    bool isValid = false;
 
     switch(id)
     {
         case OUTLET_TEMPERATURE:
-            data = GetOutletTemperature();
+            isValid = GetOutletTemperature(value);
+            break;
+        case INLET_TEMPERATURE:
+            isValid = GetInletTemperature(value);
+            break;
+        case TOP_MEZZ_TEMPERATURE:
+            isValid = GetTopMezzTemperature(value);
+            break;
+        case BOTTOM_MEZZ_TEMPERATURE:
+            isValid = GetBottomMezzTemperature(value);
             break;
         default:
             break;
     }
 
-    return data;
+    return isValid;
 }
 
 void BoardDriver::SetInletTmpLowLimit(float llim)
@@ -956,6 +1295,24 @@ void BoardDriver::SetBottomMezzTmpHighLimit(float hlim)
     mupBottomMezzTmp112->SetTmpHighLimit(hlim);
 }
 
+int BoardDriver::EnableTmpAlertMode(boost::function<void()> alertCb)
+{
+    int ret = 0;
+
+    if (mupOutletTmp112->SetAlertMode(cOutLetTmpLLim, cOutLetTmpHLim))
+    {
+        ret = -1;
+    }
+
+    mupTmp112Sampler->SetAlertCallback(alertCb);
+
+    // Sampler applies these and re-applies them after each mezz bring-up
+    mupTmp112Sampler->SetAlertMode(TMP112_TOP_MEZZ, cDefaultTmpLowLimit, cDefaultTmpHighLimit);
+    mupTmp112Sampler->SetAlertMode(TMP112_BOTTOM_MEZZ, cDefaultTmpLowLimit, cDefaultTmpHighLimit);
+
+    return ret;
+}
+
 /*
  * Reset whole CHM6
  * Blue Gecko GMCU_PS_POR_L signal controls the Power-On-Reset (POR)
@@ -1132,6 +1489,9 @@ void BoardDriver::DumpLog(std::ostream &os)
         os << "BoardDriver Log is not created!" << std::endl;
     }
 
+    os << std::endl << "BoardDriver Trace:" << std::endl;
+
+    mTrace.Dump(os);
 }
 
 void BoardDriver::DumpStatus(std::ostream &os, std::string cmd)
@@ -1140,12 +1500,8 @@ void BoardDriver::DumpStatus(std::ostream &os, std::string cmd)
 
     if (cmd == std::string("tmp"))
     {
-        os << "<<<<<<<<<<<<<<<<<<< Tmp112.DumpTmp >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
-
-        mupInletTmp112->DumpTmp(os);
-        mupOutletTmp112->DumpTmp(os);
-        mupTopMezzTmp112->DumpTmp(os);
-        mupBottomMezzTmp112->DumpTmp(os);
+        // Cached readings; use tmp_all to read the sensors directly
+        mupTmp112Sampler->Dump(os);
     }
 
     else if (cmd == std::string("tmp_all"))
@@ -1161,12 +1517,25 @@ void BoardDriver::DumpStatus(std::ostream &os, std::string cmd)
     else if (cmd == std::string("led"))
     {
         DumpLedStates(os);
+
+        os << endl;
+        mupLedShadow->Dump(os);
     }
 
     else if (cmd == std::string("sac"))
     {
         mupSacModule->Dump(os);
     }
+
+    else if (cmd == std::string("i2c_sched"))
+    {
+        BoardI2cSched::getInstance().Dump(os);
+    }
+
+    else if (cmd == std::string("ready_wait"))
+    {
+        BoardReadyWait::getInstance().Dump(os);
+    }
 }
 
 void BoardDriver::ResetLog( std::ostream &os )
@@ -1180,6 +1549,28 @@ void BoardDriver::ResetLog( std::ostream &os )
         mupLog->ResetLog();
         os << "BoardDriver Log has been reset!" << std::endl;
     }
+
+    mTrace.Reset();
+}
+
+void BoardDriver::DumpRegStats(std::ostream &os, std::string cmd)
+{
+    BoardRegStats& regStats = BoardRegStats::getInstance();
+
+    if (cmd == std::string("json"))
+    {
+        regStats.DumpJson(os);
+    }
+    else if (cmd == std::string("reset"))
+    {
+        regStats.Reset();
+        BoardI2cSched::getInstance().Reset();
+        os << "Register access and I2C scheduler stats have been reset!" << std::endl;
+    }
+    else
+    {
+        regStats.Dump(os);
+    }
 }
 
 /*
@@ -1232,6 +1623,8 @@ void BoardDriver::PlI2c3IoxWrite (uint32 offset, uint8 data)
  */
 uint8 BoardDriver::I2c2PllRead (uint32 offset)
 {
+    I2cTransaction txn(REG_BUS_PL_I2C2);
+
     return (mspBottomMzSi5394Drv->Read(offset));
 }
 
@@ -1240,6 +1633,8 @@ uint8 BoardDriver::I2c2PllRead (uint32 offset)
  */
 void BoardDriver::I2c2PllWrite (uint32 offset, uint8 data)
 {
+    I2cTransaction txn(REG_BUS_PL_I2C2);
+
     mspBottomMzSi5394Drv->Write(offset, data);
 }
 
@@ -1248,6 +1643,8 @@ void BoardDriver::I2c2PllWrite (uint32 offset, uint8 data)
  */
 void BoardDriver::I2c2PllConfig ()
 {
+    I2cTransaction txn(REG_BUS_PL_I2C2);
+
     mspBottomMzSi5394Drv->Configure(msSi5394_RegList);
 }
 
@@ -1256,6 +1653,8 @@ void BoardDriver::I2c2PllConfig ()
  */
 uint8 BoardDriver::I2c3PllRead (uint32 offset)
 {
+    I2cTransaction txn(REG_BUS_PL_I2C3);
+
     return (mspTopMzSi5394Drv->Read(offset));
 }
 
@@ -1264,6 +1663,8 @@ uint8 BoardDriver::I2c3PllRead (uint32 offset)
  */
 void BoardDriver::I2c3PllWrite (uint32 offset, uint8 data)
 {
+    I2cTransaction txn(REG_BUS_PL_I2C3);
+
     mspTopMzSi5394Drv->Write(offset, data);
 }
 
@@ -1272,6 +1673,8 @@ void BoardDriver::I2c3PllWrite (uint32 offset, uint8 data)
  */
 void BoardDriver::I2c3PllConfig ()
 {
+    I2cTransaction txn(REG_BUS_PL_I2C3);
+
     mspTopMzSi5394Drv->Configure(msSi5394_RegList);
 }
 
@@ -1286,10 +1689,19 @@ void BoardDriver::MdioWrite (uint8 bus_sel, uint16 mdio_addr,
     mspFpgaPlMdioIf->Write16(bus_sel, mdio_addr, offset, data);
 }
 
+// bus_sel 0..4 is PL I2C0..4; anything else is not arbitrated
+static RegBusType PlI2cBusSelToBus(uint8 bus_sel)
+{
+    return ((bus_sel <= 4) ? RegBusType(REG_BUS_PL_I2C0 + bus_sel) : NUM_REG_BUSES);
+}
+
 uint16 BoardDriver::I2cRead8 (uint8 bus_sel, uint16 phy_addr, uint64 offset)
 {
     uint16 data = 0xde;
 
+    // Address select and access go out as one transaction
+    I2cTransaction txn(PlI2cBusSelToBus(bus_sel));
+
     switch ( bus_sel )
     {
         case 0:
@@ -1340,6 +1752,8 @@ uint16 BoardDriver::I2cRead8 (uint8 bus_sel, uint16 phy_addr, uint64 offset)
 void BoardDriver::I2cWrite8 (uint8 bus_sel, uint16 phy_addr,
                uint64 offset, uint16 data)
 {
+    I2cTransaction txn(PlI2cBusSelToBus(bus_sel));
+
     switch ( bus_sel )
     {
         case 0:
@@ -1389,6 +1803,8 @@ uint16 BoardDriver::I2cRead16 (uint8 bus_sel, uint16 phy_addr, uint64 offset)
 {
     uint16 data = 0xde;
 
+    I2cTransaction txn(PlI2cBusSelToBus(bus_sel));
+
     switch ( bus_sel )
     {
         case 0:
@@ -1439,6 +1855,8 @@ uint16 BoardDriver::I2cRead16 (uint8 bus_sel, uint16 phy_addr, uint64 offset)
 void BoardDriver::I2cWrite16 (uint8 bus_sel, uint16 phy_addr,
                uint64 offset, uint16 data)
 {
+    I2cTransaction txn(PlI2cBusSelToBus(bus_sel));
+
     switch ( bus_sel )
     {
         case 0:
@@ -1485,18 +1903,27 @@ void BoardDriver::I2cWrite16 (uint8 bus_sel, uint16 phy_addr,
 }
 
 /*
- * CLI commands for MFG EEPROM
+ * CLI commands for MFG EEPROM. The library reaches PL_I2C4 through the
+ * raw handle and cannot be arbitrated per access, so device reads are
+ * done here one byte per grant; library calls that only move the image
+ * buffer take no grant.
  */
 void BoardDriver::ImportMfgEepromFromBinFile(std::ostream& out, std::string& filename)
 {
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
     mupMfgEepromDrv->ImportFromBinFile(filename.c_str());
 
+    InvalidateEqptInventory();
+
     out << "Imported file: " << filename
         << " into buffer: " << mupMfgEepromDrv->GetEepromBinBufSrcName() << std::endl;
 }
 
 void BoardDriver::ExportMfgEepromToBinFile(std::ostream& out, std::string& filename)
 {
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
     mupMfgEepromDrv->ExportToBinFile(filename.c_str());
     out << "Exported buffer: " << mupMfgEepromDrv->GetEepromBinBufSrcName()
         << " to file: " << filename  << std::endl;
@@ -1504,23 +1931,255 @@ void BoardDriver::ExportMfgEepromToBinFile(std::ostream& out, std::string& filen
 
 void BoardDriver::ReadFromMfgEeprom(std::ostream& out)
 {
-    mupMfgEepromDrv->ReadFromEeprom();
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
+    std::vector<uint8> vBinBuf(cFpgaSkickMfgEepromSize);
+
+    if (ReadMfgEepromImage(vBinBuf))
+    {
+        out << "MFG EEPROM read FAILED" << std::endl;
+        return;
+    }
+
+    // Into the library buffer the way a bin file would go
+    {
+        std::ofstream ofs(cMfgEepromReadFile, std::ios::binary | std::ios::trunc);
+
+        ofs.write((const char*)vBinBuf.data(), vBinBuf.size());
+
+        if (!ofs.flush())
+        {
+            out << "MFG EEPROM read: cannot stage " << cMfgEepromReadFile << std::endl;
+            return;
+        }
+    }
+
+    mupMfgEepromDrv->ImportFromBinFile(cMfgEepromReadFile);
     mupMfgEepromDrv->DumpEepromBinBufSrcName(out);
+
+    remove(cMfgEepromReadFile);
+
+    InvalidateEqptInventory();
+}
+
+int BoardDriver::ReadMfgEepromImage(std::vector<uint8>& vBinBuf)
+{
+    uint32 offset = 0;
+
+    try
+    {
+        // Grant per byte through the probe; fault reads get in between
+        for (offset = 0; offset < vBinBuf.size(); offset++)
+        {
+            vBinBuf[offset] = mspMfgEepromDrvRegIf->Read8(offset);
+        }
+    }
+    catch (regIf::RegIfException &ex)
+    {
+        INFN_LOG(SeverityLevel::error) << "MFG EEPROM read failed at offset 0x" << std::hex << offset
+                                       << std::dec << ". Ex: " << ex.GetError();
+        return -1;
+    }
+
+    return 0;
 }
 
+// Byte per grant; the library full write is only the write protect fallback
 void BoardDriver::WriteToMfgEeprom(std::ostream& out)
 {
+    ProgramMfgEeprom(out);
+}
+
+/*
+ * Page by page diff against the EEPROM itself. Only differing bytes get
+ * a write cycle; the FPGA I2C interface has no block write, so a page
+ * cannot go out in one cycle. After each write the byte is read until
+ * the device ACKs again, so the wait ends with the write cycle and the
+ * same read verifies the byte. Write protect belongs to the MfgEeprom
+ * library; while it is set the first byte does not verify and the
+ * library full write, which drives write protect itself, takes over.
+ */
+void BoardDriver::ProgramMfgEeprom(std::ostream& out)
+{
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
     mupMfgEepromDrv->DumpEepromBinBufSrcName(out);
-    mupMfgEepromDrv->WriteToEeprom();
+
+    std::vector<uint8> vBinBuf(cFpgaSkickMfgEepromSize);
+
+    // Library buffer copy; no bus access
+    mupMfgEepromDrv->GetEepromBin(vBinBuf.data());
+
+    auto start = std::chrono::steady_clock::now();
+
+    uint32 numPages        = (cFpgaSkickMfgEepromSize + cMfgEepromPageSize - 1) / cMfgEepromPageSize;
+    uint32 numPagesWritten = 0;
+    uint32 numBytesWritten = 0;
+
+    int errCode = 0;
+    uint32 offset = 0;
+
+    try
+    {
+        for (uint32 page = 0; (page < numPages) && (errCode == 0); page++)
+        {
+            uint32 pageEnd = std::min((page + 1) * cMfgEepromPageSize, (uint32)cFpgaSkickMfgEepromSize);
+            bool isPageWritten = false;
+
+            for (offset = page * cMfgEepromPageSize; offset < pageEnd; offset++)
+            {
+                // Bus held for a byte; a write cycle is the longest hold
+                I2cTransaction txn(mspMfgEepromDrvRegIf.GetBus());
+
+                if (mspMfgEepromDrvRegIf->Read8(offset) == vBinBuf[offset])
+                {
+                    continue;
+                }
+
+                mspMfgEepromDrvRegIf->Write8(offset, vBinBuf[offset]);
+
+                errCode = WaitMfgEepromWrite(offset, vBinBuf[offset]);
+
+                if (errCode)
+                {
+                    break;
+                }
+
+                numBytesWritten++;
+                isPageWritten = true;
+            }
+
+            if (isPageWritten)
+            {
+                numPagesWritten++;
+            }
+        }
+    }
+    catch (regIf::RegIfException &ex)
+    {
+        out << "MFG EEPROM access failed at offset 0x" << std::hex << offset << std::dec
+            << ". Ex: " << ex.GetError() << std::endl;
+        errCode = -3;
+    }
+
+    InvalidateEqptInventory();
+
+    if ((errCode == -2) && (numBytesWritten == 0))
+    {
+        // Nothing took; the library write drives write protect on its own
+        out << "MFG EEPROM offset 0x" << std::hex << offset << std::dec
+            << " did not verify. Falling back to full write" << std::endl;
+
+        try
+        {
+            {
+                // One library call, write protect included; cannot be split per byte
+                I2cTransaction txn(mspMfgEepromDrvRegIf.GetBus());
+
+                mupMfgEepromDrv->WriteToEeprom();
+            }
+
+            offset  = VerifyMfgEeprom(vBinBuf);
+            errCode = (offset < cFpgaSkickMfgEepromSize) ? -2 : 0;
+        }
+        catch (regIf::RegIfException &ex)
+        {
+            out << "MFG EEPROM full write failed. Ex: " << ex.GetError() << std::endl;
+            errCode = -3;
+        }
+
+        // The library write may have gone part way
+        InvalidateEqptInventory();
+
+        out << "MFG EEPROM full write " << (errCode ? "FAILED" : "verified");
+        if (errCode == -2)
+        {
+            out << " at offset 0x" << std::hex << offset << std::dec;
+        }
+        out << std::endl;
+
+        INFN_LOG(SeverityLevel::info) << "MFG EEPROM full write. errCode: " << errCode;
+        return;
+    }
+
+    uint32 durMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - start).count();
+
+    if (errCode)
+    {
+        out << "MFG EEPROM programming FAILED at offset 0x" << std::hex << offset << std::dec
+            << (errCode == -2 ? " (verify)" : (errCode == -1 ? " (write cycle timeout)" : " (access)")) << std::endl;
+    }
+
+    out << "Pages: " << numPages << " written: " << numPagesWritten
+        << " bytes written: " << numBytesWritten << " in " << durMs << " ms" << std::endl;
+
+    INFN_LOG(SeverityLevel::info) << "MFG EEPROM programmed. Pages written: " << numPagesWritten
+                                  << " bytes: " << numBytesWritten << " errCode: " << errCode
+                                  << " in " << durMs << " ms";
+}
+
+int BoardDriver::WaitMfgEepromWrite(uint32 offset, uint8 data)
+{
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(cMfgEepromWriteCycleMaxMs);
+
+    while (true)
+    {
+        try
+        {
+            // NACKed until the write cycle is over
+            return ((mspMfgEepromDrvRegIf->Read8(offset) == data) ? 0 : -2);
+        }
+        catch (regIf::RegIfException&)
+        {
+            // Still in the write cycle
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return -1;
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(cMfgEepromAckPollUs));
+    }
+}
+
+uint32 BoardDriver::VerifyMfgEeprom(const std::vector<uint8>& vBinBuf)
+{
+    uint32 offset;
+
+    for (offset = 0; offset < vBinBuf.size(); offset++)
+    {
+        if (mspMfgEepromDrvRegIf->Read8(offset) != vBinBuf[offset])
+        {
+            break;
+        }
+    }
+
+    return offset;
 }
 
 void BoardDriver::DumpEepromBin(std::ostream& out)
 {
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
     mupMfgEepromDrv->DumpEepromBin(out);
 }
 
 void BoardDriver::DumpEepromFields(std::ostream& out, int level)
 {
+    Chm6EqptInventory inv;
+
+    GetEqptInventory(inv);
+
+    out << "Inventory:" << std::endl;
+    inv.Dump(out);
+    DumpEqptInvCache(out);
+    out << std::endl;
+
+    std::lock_guard<std::recursive_mutex> guard(mRMutexMfgEepromWrPretect);
+
     mupMfgEepromDrv->DumpEepromFields(out, level);
 }
 
@@ -1792,6 +2451,8 @@ void BoardDriver::DumpHostADM1066Revision(std::ostream& out)
 {
     unsigned short eeprom_rev_addr = cAdm1066EepromRevAddr;
 
+    I2cTransaction txn(REG_BUS_PS_I2C0);
+
     mspFpgaPsI2c0PwrSeqIf->WriteByteData((eeprom_rev_addr & 0xff00) >> 8, eeprom_rev_addr & 0xff);
     uint32 ver = mspFpgaPsI2c0PwrSeqIf->ReadByte();
 
@@ -1807,8 +2468,12 @@ void BoardDriver::DumpHostAdm1066Eeprom(std::ostream& out)
 
     for (int i=0; i<64; ++i, ++eeprom_addr)
     {
-        mspFpgaPsI2c0PwrSeqIf->WriteByteData((eeprom_addr & 0xff00) >> 8, eeprom_addr & 0xff);
-        value = mspFpgaPsI2c0PwrSeqIf->ReadByte();
+        {
+            // Pointer set and read as one transaction; faults get in between bytes
+            I2cTransaction txn(REG_BUS_PS_I2C0);
+            mspFpgaPsI2c0PwrSeqIf->WriteByteData((eeprom_addr & 0xff00) >> 8, eeprom_addr & 0xff);
+            value = mspFpgaPsI2c0PwrSeqIf->ReadByte();
+        }
         out << boost::format("%02x") % value << " ";
         if ((i & 0xf) == 0xf)
             out << std::endl;
@@ -1823,6 +2488,7 @@ void BoardDriver::DumpHostAdm1066Eeprom(std::ostream& out)
 
     for (uint i = 0; i < 8; ++i)
     {
+        I2cTransaction txn(REG_BUS_PS_I2C0);
         mspFpgaPsI2c0PwrSeqIf->WriteByteData(0xf8, offset);
         mspFpgaPsI2c0PwrSeqIf->ReadBlockData(cAdm1066BlockReadCode, block+offset);
         offset += 0x20;
@@ -1844,8 +2510,11 @@ void BoardDriver::DumpHostAdm1066Eeprom(std::ostream& out)
 
     for (int i=0; i<64; ++i, ++eeprom_addr)
     {
-        mspFpgaPsI2c0PwrSeqIf->WriteByteData((eeprom_addr & 0xff00) >> 8, eeprom_addr & 0xff);
-        value = mspFpgaPsI2c0PwrSeqIf->ReadByte();
+        {
+            I2cTransaction txn(REG_BUS_PS_I2C0);
+            mspFpgaPsI2c0PwrSeqIf->WriteByteData((eeprom_addr & 0xff00) >> 8, eeprom_addr & 0xff);
+            value = mspFpgaPsI2c0PwrSeqIf->ReadByte();
+        }
         out << boost::format("%02x") % value << " ";
         if ((i & 0xf) == 0xf)
             out << std::endl;
@@ -1878,109 +2547,123 @@ void BoardDriver::CreateRegIf()
 
 	RegIfFactorySingleton::InstallInstance(pFactory);
 
-    mspFpgaPlRegIf = pFactory->CreateFpgaPlRegIf();
+    mspFpgaPlRegIf.Attach(pFactory->CreateFpgaPlRegIf(), REG_BUS_FPGA, "FpgaPl");
+
+    mspFpgaPlMiscIf.Attach(pFactory->CreateFpgaMiscRegIf(), REG_BUS_FPGA, "FpgaMisc");
+
+    mupLedShadow = make_unique<LedRegShadow>(&mspFpgaPlMiscIf);
 
-    mspFpgaPlMiscIf = pFactory->CreateFpgaMiscRegIf();
+    BuildLedDecodeTable();
+
+    mupLedShadow->AddField(cFpgaLedReg3_FRU_ACTIVE_LED_Addr, cFpgaLedReg3_FRU_ACTIVE_mask);
+    mupLedShadow->AddField(cFpgaLedReg3_FRU_FAULT_LED_Addr, cFpgaLedReg3_FRU_FAULT_mask);
 
     /*
      * I2C[0] assigned to bottom MEZZ I2C[0]
      */
-    mspFpgaPlI2c0RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus0);
+    mspFpgaPlI2c0RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus0), REG_BUS_PL_I2C0, "I2c0");
 
-    mspFpgaPlI2c0VolSeqIf = pFactory->CreateFpgaPlI2c0VoltageSequencerRegIf();
+    mspFpgaPlI2c0VolSeqIf.Attach(pFactory->CreateFpgaPlI2c0VoltageSequencerRegIf(), REG_BUS_PL_I2C0, "I2c0VolSeq");
 
-    mspFpgaPlI2c0_3_3VPwrSupplyIf = pFactory->CreateFpgaPlI2c03_3VPwrSupplyRegIf();
+    mspFpgaPlI2c0_3_3VPwrSupplyIf.Attach(pFactory->CreateFpgaPlI2c03_3VPwrSupplyRegIf(), REG_BUS_PL_I2C0, "I2c0_3_3VPwrSupply");
 
-    mspFpgaPlI2c0_0_8VPwrSupplyIf = pFactory->CreateFpgaPlI2c00_8VPwrSupplyRegIf();
+    mspFpgaPlI2c0_0_8VPwrSupplyIf.Attach(pFactory->CreateFpgaPlI2c00_8VPwrSupplyRegIf(), REG_BUS_PL_I2C0, "I2c0_0_8VPwrSupply");
 
-    mspFpgaPlI2c0TempSensorIf = pFactory->CreateFpgaPlI2c0TempSensorRegIf();
+    mspFpgaPlI2c0TempSensorIf.Attach(pFactory->CreateFpgaPlI2c0TempSensorRegIf(), REG_BUS_PL_I2C0, "I2c0TempSensor");
 
     /*
      * I2C[1] assigned to top MEZZ I2C[1]
      */
-    mspFpgaPlI2c1RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus1);
+    mspFpgaPlI2c1RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus1), REG_BUS_PL_I2C1, "I2c1");
 
-    mspFpgaPlI2c1VolSeqIf = pFactory->CreateFpgaPlI2c1VoltageSequencerRegIf();
+    mspFpgaPlI2c1VolSeqIf.Attach(pFactory->CreateFpgaPlI2c1VoltageSequencerRegIf(), REG_BUS_PL_I2C1, "I2c1VolSeq");
 
-    mspFpgaPlI2c1_3_3VPwrSupplyIf = pFactory->CreateFpgaPlI2c13_3VPwrSupplyRegIf();
+    mspFpgaPlI2c1_3_3VPwrSupplyIf.Attach(pFactory->CreateFpgaPlI2c13_3VPwrSupplyRegIf(), REG_BUS_PL_I2C1, "I2c1_3_3VPwrSupply");
 
-    mspFpgaPlI2c1_0_8VPwrSupplyIf = pFactory->CreateFpgaPlI2c10_8VPwrSupplyRegIf();
+    mspFpgaPlI2c1_0_8VPwrSupplyIf.Attach(pFactory->CreateFpgaPlI2c10_8VPwrSupplyRegIf(), REG_BUS_PL_I2C1, "I2c1_0_8VPwrSupply");
 
-    mspFpgaPlI2c1TempSensorIf = pFactory->CreateFpgaPlI2c1TempSensorRegIf();
+    mspFpgaPlI2c1TempSensorIf.Attach(pFactory->CreateFpgaPlI2c1TempSensorRegIf(), REG_BUS_PL_I2C1, "I2c1TempSensor");
 
     /*
      * I2C[2] assigned to bottom MEZZ I2C[2]
      */
-    mspFpgaPlI2c2RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus2);
+    mspFpgaPlI2c2RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus2), REG_BUS_PL_I2C2, "I2c2");
 
-    mspBottomMzFPC402_1RegIf = pFactory->CreateBottomMzFPC402_1RegIf();
+    mspBottomMzFPC402_1RegIf.Attach(pFactory->CreateBottomMzFPC402_1RegIf(), REG_BUS_PL_I2C2, "BottomMzFPC402_1");
 
-    mspBottomMzFPC402_2RegIf = pFactory->CreateBottomMzFPC402_2RegIf();
+    mspBottomMzFPC402_2RegIf.Attach(pFactory->CreateBottomMzFPC402_2RegIf(), REG_BUS_PL_I2C2, "BottomMzFPC402_2");
 
-    mspBottomMzIoExpIf = pFactory->CreateBottomMzIOExpanderRegIf();
+    mspBottomMzIoExpIf.Attach(pFactory->CreateBottomMzIOExpanderRegIf(), REG_BUS_PL_I2C2, "BottomMzIoExp");
 
     mspBottomMzSi5394Drv = pFactory->CreateBottomMzSi5394Drv();
 
     /*
      * I2C[3] assigned to top MEZZ I2C[3]
      */
-    mspFpgaPlI2c3RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus3);
+    mspFpgaPlI2c3RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus3), REG_BUS_PL_I2C3, "I2c3");
 
-    mspTopMzFPC402_1RegIf = pFactory->CreateTopMzFPC402_1RegIf();
+    mspTopMzFPC402_1RegIf.Attach(pFactory->CreateTopMzFPC402_1RegIf(), REG_BUS_PL_I2C3, "TopMzFPC402_1");
 
-    mspTopMzFPC402_2RegIf = pFactory->CreateTopMzFPC402_2RegIf();
+    mspTopMzFPC402_2RegIf.Attach(pFactory->CreateTopMzFPC402_2RegIf(), REG_BUS_PL_I2C3, "TopMzFPC402_2");
 
-    mspTopMzIoExpIf = pFactory->CreateTopMzIOExpanderRegIf();
+    mspTopMzIoExpIf.Attach(pFactory->CreateTopMzIOExpanderRegIf(), REG_BUS_PL_I2C3, "TopMzIoExp");
 
     mspTopMzSi5394Drv = pFactory->CreateTopMzSi5394Drv();
 
     /*
      * I2C[4] assigned to SKICK I2C
      */
-    mspFpgaPlI2c4RegIf = pFactory->CreateFpgaPlI2cRegIf(PlI2cBus4);
+    mspFpgaPlI2c4RegIf.Attach(pFactory->CreateFpgaPlI2cRegIf(PlI2cBus4), REG_BUS_PL_I2C4, "I2c4");
 
-    mspFpgaPlI2c4InletTempSensorIf = pFactory->CreateFpgaPlI2c4InletTempSensorRegIf();
+    mspFpgaPlI2c4InletTempSensorIf.Attach(pFactory->CreateFpgaPlI2c4InletTempSensorRegIf(), REG_BUS_PL_I2C4, "I2c4InletTempSensor");
 
-    mspFpgaPlI2c4OutletTempSensorIf = pFactory->CreateFpgaPlI2c4OutletTempSensorRegIf();
+    mspFpgaPlI2c4OutletTempSensorIf.Attach(pFactory->CreateFpgaPlI2c4OutletTempSensorRegIf(), REG_BUS_PL_I2C4, "I2c4OutletTempSensor");
 
-    mspMfgEepromDrvRegIf = pFactory->CreateFpgaPlI2c4MfgEepromRegIf();
+    mspMfgEepromDrvRegIf.Attach(pFactory->CreateFpgaPlI2c4MfgEepromRegIf(), REG_BUS_PL_I2C4, "MfgEepromDrv");
 
     mupMfgEepromDrv = make_unique<MfgEeprom>(mspMfgEepromDrvRegIf.get(),
                                              mspFpgaPlMiscIf.get(),
                                              mRMutexMfgEepromWrPretect,
                                              cFpgaSkickMfgEepromSize);
 
-    mspFpgaPlMdioIf = pFactory->CreateFpgaPlMdioRegIf();
+    mspFpgaPlMdioIf.Attach(pFactory->CreateFpgaPlMdioRegIf(), REG_BUS_MDIO, "Mdio");
 
     /*
      * TMP112 temperature sensors on PL
      */
     mupTopMezzTmp112 = make_unique<Tmp112>("Top Mezz Temperature Sensor",
-                                            mspFpgaPlI2c1TempSensorIf.get());
+                                            &mspFpgaPlI2c1TempSensorIf);
 
     mupBottomMezzTmp112 = make_unique<Tmp112>("Bottom Mezz Temperature Sensor",
-                                               mspFpgaPlI2c0TempSensorIf.get());
+                                               &mspFpgaPlI2c0TempSensorIf);
 
     mupInletTmp112 = make_unique<Tmp112>("Inlet Temperature Sensor",
-                                          mspFpgaPlI2c4InletTempSensorIf.get());
+                                          &mspFpgaPlI2c4InletTempSensorIf);
 
     mupOutletTmp112 = make_unique<Tmp112>("Outlet Temperature Sensor",
-                                           mspFpgaPlI2c4OutletTempSensorIf.get());
+                                           &mspFpgaPlI2c4OutletTempSensorIf);
 
     mupOutletTmp112->SetTmpLowLimit(cOutLetTmpLLim);
     mupOutletTmp112->SetTmpHighLimit(cOutLetTmpHLim);
 
+    mupTmp112Sampler = make_unique<Tmp112Sampler>();
+
+    mupTmp112Sampler->AddSensor(TMP112_INLET, mupInletTmp112.get());
+    mupTmp112Sampler->AddSensor(TMP112_OUTLET, mupOutletTmp112.get());
+    mupTmp112Sampler->AddSensor(TMP112_TOP_MEZZ, mupTopMezzTmp112.get());
+    mupTmp112Sampler->AddSensor(TMP112_BOTTOM_MEZZ, mupBottomMezzTmp112.get());
+
     /*
      * SAC bus on FPGA PL
      */
 
-    mupSacModule = make_unique<SacModule>("SAC Module", mspFpgaPlRegIf.get());
+    mupSacModule = make_unique<SacModule>("SAC Module", &mspFpgaPlRegIf);
     mupSacModule->SetSacModuleEnable(true, true);
 
     /*
      * RegIf for FPGA PS interface
      */
-    mspFpgaPsI2c0PwrSeqIf = pFactory->CreateFpgaPsI2c0PwrSeqIf();
+    mspFpgaPsI2c0PwrSeqIf.Attach(pFactory->CreateFpgaPsI2c0PwrSeqIf(), REG_BUS_PS_I2C0, "I2c0PwrSeq");
 }
 
 void BoardDriver::MonitorStatus()
@@ -1990,11 +2673,22 @@ void BoardDriver::MonitorStatus()
     AddLog(__func__, __LINE__, log.str());
     INFN_LOG(SeverityLevel::info) << log.str();
 
+    uint32 ledVerifySec = 0;
+
     while (true)
     {
         // Monitor SRC bus RX clock error and re-enable RX
         mupSacModule->CheckRedoSacModuleRxEnable();
 
+        // Restore LED fields lost to e.g. an FPGA reload
+        if (++ledVerifySec >= cLedShadowVerifyPeriodSec)
+        {
+            RegCallerScope callerScope(REG_CALLER_LED);
+
+            mupLedShadow->Verify();
+            ledVerifySec = 0;
+        }
+
         // Check if cold restart DCO
         if (mColdRestartDcoDelaySec == 0)
         {
@@ -2018,35 +2712,55 @@ void BoardDriver::MonitorStatus()
 /*
  * Inlet temp: PL SKICK I2C
  */
-float32 BoardDriver::GetInletTemperature()
+bool BoardDriver::GetInletTemperature(float32& temperature)
 {
-    float32 tmp = 0;
-    mupInletTmp112->GetTmperature(tmp);
-    return tmp;
+    return GetCachedTemperature(TMP112_INLET, temperature);
 }
 
 /*
  * Outlet temp: PL SKICK I2C
  */
-float32 BoardDriver::GetOutletTemperature()
+bool BoardDriver::GetOutletTemperature(float32& temperature)
 {
-    float32 tmp = 0;
-    mupOutletTmp112->GetTmperature(tmp);
-    return tmp;
+    return GetCachedTemperature(TMP112_OUTLET, temperature);
 }
 
-float32 BoardDriver::GetTopMezzTemperature()
+bool BoardDriver::GetTopMezzTemperature(float32& temperature)
 {
-    float32 tmp = 0;
-    mupTopMezzTmp112->GetTmperature(tmp);
-    return tmp;
+    return GetCachedTemperature(TMP112_TOP_MEZZ, temperature);
 }
 
-float32 BoardDriver::GetBottomMezzTemperature()
+bool BoardDriver::GetBottomMezzTemperature(float32& temperature)
 {
-    float32 tmp = 0;
-    mupBottomMezzTmp112->GetTmperature(tmp);
-    return tmp;
+    return GetCachedTemperature(TMP112_BOTTOM_MEZZ, temperature);
+}
+
+/*
+ * Last sampled value; no bus access on the caller's thread
+ */
+bool BoardDriver::GetCachedTemperature(Tmp112SensorType type, float32& temperature)
+{
+    Tmp112Reading reading;
+
+    if (!mupTmp112Sampler->GetReading(type, reading) || !reading.mIsValid)
+    {
+        return false;
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    sint64 ageMs = (now.tv_sec - reading.mTimestamp.tv_sec) * 1000
+                 + (now.tv_nsec - reading.mTimestamp.tv_nsec) / 1000000;
+
+    if (ageMs > cTmp112MaxSampleAgeMs)
+    {
+        return false;
+    }
+
+    temperature = reading.mTemperature;
+
+    return true;
 }
 
 /*
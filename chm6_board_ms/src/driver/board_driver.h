@@ -11,10 +11,13 @@
 #include <string>
 #include <mutex>
 #include <memory>
+#include <vector>
 
 #include "board_defs.h"
 
 #include "SimpleLog.h"
+#include "board_trace.h"
+#include "board_reg_probe.h"
 
 #include "RegIfFactory.h"
 #include "MfgEeprom.h"
@@ -22,7 +25,9 @@
 #include "board_common_driver.h"
 
 #include "Tmp112.h"
+#include "Tmp112Sampler.h"
 #include "SacModule.h"
+#include "LedRegShadow.h"
 
 using namespace std;
 using namespace boardMs;
@@ -39,6 +44,10 @@ public:
      * Read PFGA PL I2C Bus4 SKICK MFG MFG EEPROM
      * cFpgaI2cBus0Offset = 0x0F00;
      * CAV24C02 = 7�b1010100
+     *
+     * Served from the decoded copy while a CRC of the leading header
+     * bytes and the stored TLV area CRC is unchanged; decoded again after
+     * either changes or this process writes the EEPROM.
      */
     void GetEqptInventory(Chm6EqptInventory& inv);
 
@@ -83,6 +92,12 @@ public:
 
     int GetMezzLineLedState(LineId lineId, LineLedType ledType, LedStateType& ledState);
 
+    // All QSFP and line LEDs, one read per distinct LED register
+    int GetMezzLedStates(MezzLedStates& ledStates);
+
+    // Batched set; LEDs at LED_STATE_UNKNOWN are left as they are
+    int SetMezzLedStates(const MezzLedStates& ledStates);
+
     /*
      * GX FRU ACTIVE LED "Flashing GREEN" shall be used when module is warm booting to align to Groove behavior.
      * GX FRU FAULT LED "Flashing RED" shall be used when module is cold booting.
@@ -136,7 +151,8 @@ public:
      */
     void UpdateHwStatusToFDR(); // ?? Are these done by SW ??
 
-    float32 GetPm(BoardPmId id);
+    // False if no current value; value is left unchanged then
+    bool GetPm(BoardPmId id, float32& value);
 
     /*
      * Inlet temp: PL SKICK I2C
@@ -162,6 +178,18 @@ public:
 
     void SetBottomMezzTmpHighLimit(float hlim);
 
+    /*
+     * Put outlet and mezz TMP112s in comparator mode against their limits.
+     * Outlet ALERT drives the FPGA TEMP_ALARM status bit; mezz ALERT pins
+     * are not wired so the sampler keeps their alert mode applied, reads
+     * their AL bit and calls alertCb when it changes. Returns the outlet
+     * result; mezz sensors fall back to threshold polling on their own.
+     */
+    int EnableTmpAlertMode(boost::function<void()> alertCb);
+
+    // Cached readings and alert state; never touches I2C
+    Tmp112Sampler* GetTmp112Sampler() { return mupTmp112Sampler.get(); }
+
     /*
      * Reset whole CHM6
      * Blue Gecko GMCU_PS_POR_L signal controls the Power-On-Reset (POR)
@@ -243,6 +271,8 @@ public:
 
     void ResetLog( std::ostream &os );
 
+    // cmd is "table", "json" or "reset"
+    void DumpRegStats(std::ostream &os, std::string cmd);
 
     /*
      * CLI commands to access RegIf
@@ -330,12 +360,17 @@ public:
 
     void WriteToMfgEeprom(std::ostream& out);
 
+    // Write only the buffer pages that differ from the EEPROM, verifying each byte
+    void ProgramMfgEeprom(std::ostream& out);
+
     void DumpEepromBin(std::ostream& out);
 
     void DumpEepromFields(std::ostream& out, int level);
 
     void DumpEepromBinBufSrcName(std::ostream& out);
 
+    void DumpEqptInvCache(std::ostream& out);
+
     /*
      * CLI commands for LED
      */
@@ -393,18 +428,57 @@ private:
      */
     void CreateRegIf();
 
+    /*
+     * Build the LED decode table and declare the QSFP and line LED fields
+     * to the shadow
+     */
+    void BuildLedDecodeTable();
+
+    uint32 AddLedDecodeReg(uint32 regOffset);
+
+    static LedStateType QsfpLedBitsToState(QSFPLedType ledType, uint32 data);
+
+    static LedStateType LineLedBitsToState(LineLedType ledType, uint32 data);
+
+    static bool QsfpLedStateToBits(QSFPLedType ledType, LedStateType ledState, uint32& colorBits);
+
+    static bool LineLedStateToBits(LineLedType ledType, LedStateType ledState, uint32& colorBits);
+
+    /*
+     * MFG EEPROM inventory cache; callers hold mRMutexMfgEepromWrPretect
+     */
+    // Also returns the TLV area end and the probe CRC of the image decoded
+    int DecodeEqptInventory(Chm6EqptInventory& inv, uint32& tlvEnd, uint32& probeCrc);
+
+    // Whole device image, one byte per bus grant
+    int ReadMfgEepromImage(std::vector<uint8>& vBinBuf);
+
+    // CRC-32 of the few header and TLV CRC bytes read from the EEPROM itself
+    int ProbeMfgEeprom(uint32 tlvEnd, uint32& crc);
+
+    void InvalidateEqptInventory();
+
+    // 0 once the byte at offset reads back as data, -1 on timeout, -2 on mismatch
+    int WaitMfgEepromWrite(uint32 offset, uint8 data);
+
+    // Offset of the first byte differing from binBuf, size if none; throws on access error
+    uint32 VerifyMfgEeprom(const std::vector<uint8>& vBinBuf);
+
     /*
      * Period thread to monitor status
      */
     void MonitorStatus();
 
-    float32 GetInletTemperature();
+    bool GetInletTemperature(float32& temperature);
 
-    float32 GetOutletTemperature();
+    bool GetOutletTemperature(float32& temperature);
 
-    float32 GetTopMezzTemperature();
+    bool GetTopMezzTemperature(float32& temperature);
 
-    float32 GetBottomMezzTemperature();
+    bool GetBottomMezzTemperature(float32& temperature);
+
+    // False if the sensor was never read, its last read failed or the sample is stale
+    bool GetCachedTemperature(Tmp112SensorType type, float32& temperature);
 
     /*
      * Cold restart DCO
@@ -413,62 +487,75 @@ private:
 
     void AddLog(const std::string &func, uint32 line, const std::string &text);
 
-    shared_ptr<RegIf> mspFpgaPlRegIf;
+    RegIfProbe<RegIf> mspFpgaPlRegIf;
 
-    shared_ptr<FpgaMiscIf> mspFpgaPlMiscIf;
+    RegIfProbe<FpgaMiscIf> mspFpgaPlMiscIf;
     /*
      * I2C[0] assigned to bottom MEZZ I2C[0]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0RegIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0VolSeqIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0_3_3VPwrSupplyIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0_0_8VPwrSupplyIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c0TempSensorIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0VolSeqIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0_3_3VPwrSupplyIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0_0_8VPwrSupplyIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c0TempSensorIf;
 
     /*
      * I2C[1] assigned to top MEZZ I2C[1]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1RegIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1VolSeqIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1_3_3VPwrSupplyIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1_0_8VPwrSupplyIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c1TempSensorIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1VolSeqIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1_3_3VPwrSupplyIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1_0_8VPwrSupplyIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c1TempSensorIf;
 
     /*
      * I2C[2] assigned to bottom MEZZ I2C[2]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c2RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzFPC402_1RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzFPC402_2RegIf;
-    shared_ptr<FpgaI2cIf> mspBottomMzIoExpIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c2RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzFPC402_1RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzFPC402_2RegIf;
+    RegIfProbe<FpgaI2cIf> mspBottomMzIoExpIf;
     shared_ptr<Si5394> mspBottomMzSi5394Drv;
 
     /*
      * I2C[3] assigned to top MEZZ I2C[3]
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c3RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzFPC402_1RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzFPC402_2RegIf;
-    shared_ptr<FpgaI2cIf> mspTopMzIoExpIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c3RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzFPC402_1RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzFPC402_2RegIf;
+    RegIfProbe<FpgaI2cIf> mspTopMzIoExpIf;
     shared_ptr<Si5394> mspTopMzSi5394Drv;
 
     /*
      * I2C[4] assigned to SKICK I2C
      */
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c4RegIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c4InletTempSensorIf;
-    shared_ptr<FpgaI2cIf> mspFpgaPlI2c4OutletTempSensorIf;
-    shared_ptr<FpgaI2cIf> mspMfgEepromDrvRegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c4RegIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c4InletTempSensorIf;
+    RegIfProbe<FpgaI2cIf> mspFpgaPlI2c4OutletTempSensorIf;
+    RegIfProbe<FpgaI2cIf> mspMfgEepromDrvRegIf;
 
     recursive_mutex mRMutexMfgEepromWrPretect;
     unique_ptr<MfgEeprom> mupMfgEepromDrv;
 
+    struct EqptInvCache
+    {
+        bool              mIsValid;
+        uint32            mTlvEnd;        // TLV area end offset when decoded
+        uint32            mProbeCrc;      // CRC-32 of the probed bytes when decoded
+        Chm6EqptInventory mInv;
+        uint64            mNumDecodes;
+        uint64            mNumHits;
+        uint64            mNumProbeErrs;
+    };
+
+    EqptInvCache mEqptInvCache;
+
     /*
      * MDIO module contains a single driver (set of registers)
      * for up to 4 sets of MDIO interfaces or buses
      * CHM6 uses 2 sets of MDIO buses Currently
      */
-    shared_ptr<FpgaMdioIf> mspFpgaPlMdioIf;
+    RegIfProbe<FpgaMdioIf> mspFpgaPlMdioIf;
 
     /*
      * TMP112 temperature sensors on PL
@@ -481,16 +568,36 @@ private:
 
     unique_ptr<Tmp112> mupOutletTmp112;
 
+    // Owns all TMP112 bus reads; temperature getters read its cache
+    unique_ptr<Tmp112Sampler> mupTmp112Sampler;
+
     /*
      * SAC bus on FPGA PL
      */
 
     unique_ptr<SacModule> mupSacModule;
 
+    // LED register reads are served from here
+    unique_ptr<LedRegShadow> mupLedShadow;
+
+    // Where each LED field sits within mvLedRegOffsets
+    struct LedDecodeEntry
+    {
+        uint32 mRegIdx;
+        uint32 mMask;
+        uint32 mShift;
+    };
+
+    std::vector<uint32> mvLedRegOffsets;
+
+    LedDecodeEntry maQsfpLedDecode[MAX_QSFP_LED_TYPE][MAX_QSFP_NUM];
+
+    LedDecodeEntry maLineLedDecode[MAX_LINE_LED_TYPE][MAX_LINE_NUM];
+
     /*
      * RegIf for FPGA PS interface
      */
-    shared_ptr<FpgaPsI2cIf> mspFpgaPsI2c0PwrSeqIf;
+    RegIfProbe<FpgaPsI2cIf> mspFpgaPsI2c0PwrSeqIf;
 
     Chm6EqptState mBoardState;
 
@@ -512,6 +619,9 @@ private:
 
     std::unique_ptr<SimpleLog::Log> mupLog;
     mutable std::mutex  mLogLock;
+
+    // LED set paths; see BRD_TRACE
+    BoardTraceRing mTrace;
 };
 
 #endif /* CHM6_BOARD_MS_SRC_CHM6BOARDDRIVER_H_ */
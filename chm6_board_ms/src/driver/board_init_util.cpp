@@ -9,16 +9,20 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <mtd/mtd-user.h>
 #include <ctype.h>
+#include <boost/thread.hpp>
 
 #include "InfnLogger.h"
 #include "board_init_util.h"
 #include "RegIfException.h"
 #include "board_defs.h"
 #include "board_fault_defs.h"
+#include "board_boot_prof.h"
+#include "board_init_fprint.h"
 
 #define ELOG INFN_LOG(SeverityLevel::error)
 #define ILOG INFN_LOG(SeverityLevel::info)
@@ -43,6 +47,8 @@ BoardInitUtil::BoardInitUtil()
         RegIfFactory* pFactory = new RegIfFactory();
         RegIfFactorySingleton::InstallInstance(pFactory);
         mspBrdDriver = std::make_shared<BoardCommonDriver>(mIsSim, mIsEval);
+
+        BoardInitFprint::getInstance().Open();
     }
 }
 
@@ -56,6 +62,10 @@ BoardInitUtil::~BoardInitUtil()
  */
 int BoardInitUtil::ColdInit()
 {
+    RegCallerScope callerScope(REG_CALLER_INIT);
+
+    BootPhaseScope coldPhase(BOOT_PHASE_COLD_INIT);
+
     if (!IsHwEnv())
     {
       ILOG << "Running on sim or eval or hb only platform."
@@ -74,30 +84,19 @@ int BoardInitUtil::ColdInit()
 
     boardMs::mezzBoardSpecType mezzBrdSpecId;
 
-    if (mEnvStr == "")
-    {
-        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_BOTH;
-    }
-    else if (mEnvStr == "bmz")
-    {
-        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_BTM;
-    }
-    else if (mEnvStr == "tmz")
+    if (GetMezzBrdSpec(mezzBrdSpecId))
     {
-        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_TOP;
-    }
-    else
-    {
-        INFN_LOG(SeverityLevel::error) << "Env Str unexpected for HW: "
-                        << mEnvStr
-                        << " Not sure how to initialize Mezz Boards";
-
         // what todo??
         return -1;
     }
 
+    // A cold init cut short must not leave the last fingerprint valid
+    BoardInitFprint::getInstance().Invalidate();
+
     mspBrdDriver->CreateBcmDriver();
 
+    BoardBootProf& bootProf = BoardBootProf::getInstance();
+
     ILOG << "Initialize board after power up ... ";
 
     ILOG << "Checking Host Board Faults ... ";
@@ -110,6 +109,8 @@ int BoardInitUtil::ColdInit()
 
     ILOG << "1. Disable MZ board power and put both MZ in reset ...";
 
+    bootProf.Begin(BOOT_PHASE_MEZZ_PWR_OFF);
+
     if (mspBrdDriver->EnableMezzPower(false))
     {
         // Failure
@@ -120,8 +121,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_MEZZ_PWR_OFF);
+
     ILOG << "2. Configure Latch enable ...";
 
+    bootProf.Begin(BOOT_PHASE_LATCH_EN);
+
     if (mspBrdDriver->LatchEnable())
     {
         // Failure
@@ -132,8 +137,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_LATCH_EN);
+
     ILOG << "3. Enable LED Control (both MZ) ...";
 
+    bootProf.Begin(BOOT_PHASE_LED_CTRL);
+
     if (mspBrdDriver->EnableLedControl(mezzBrdSpecId))
     {
         // Failure
@@ -144,8 +153,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_LED_CTRL);
+
     ILOG << "4. Enable power to MZ boards ... ";
 
+    bootProf.Begin(BOOT_PHASE_MEZZ_PWR_ON);
+
     if (mspBrdDriver->EnableMezzPower(true))
     {
         // Failure
@@ -156,8 +169,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_MEZZ_PWR_ON);
+
     ILOG << "5. Take MZ out of reset ... ";
 
+    bootProf.Begin(BOOT_PHASE_RST_RELEASE);
+
     if (mspBrdDriver->EnableMezzReset(mezzBrdSpecId, false))
     {
         // Failure
@@ -168,8 +185,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_RST_RELEASE);
+
     ILOG << "5.a. Wait until Fpga LED controls are ready ...";
 
+    bootProf.Begin(BOOT_PHASE_LED_READY);
+
     if (mspBrdDriver->PollUntilFpgaLedReady(mezzBrdSpecId))
     {
         // Failure
@@ -180,8 +201,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_LED_READY);
+
     ILOG << "5.b. Cold boot: set Fru Fault LED to FLASHING RED ...";
 
+    bootProf.Begin(BOOT_PHASE_FAULT_LED);
+
     if (mspBrdDriver->SetFruFaultLedFlashRed())
     {
         // Failure
@@ -192,8 +217,12 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_FAULT_LED);
+
     ILOG << "6. Initialize Mezz boards ...";
 
+    bootProf.Begin(BOOT_PHASE_INIT_MEZZ);
+
     int retCode = InitMezzBoards();
     if (retCode)
     {
@@ -202,7 +231,11 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_INIT_MEZZ);
+
     ILOG << "  Initialize Gearbox BCM Driver ...";
+    bootProf.Begin(BOOT_PHASE_INIT_BCM);
+
     if (mspBrdDriver->InitBcmDriver(mezzBrdSpecId))
     {
         // Failure
@@ -213,6 +246,8 @@ int BoardInitUtil::ColdInit()
         return -1;
     }
 
+    bootProf.End(BOOT_PHASE_INIT_BCM);
+
     ILOG << "Board hardware init done.";
 
     return 0;
@@ -220,9 +255,18 @@ int BoardInitUtil::ColdInit()
 
 /*
  * Warm init
+ *
+ * The fingerprint saved by the last good init is checked against the
+ * hardware and only what no longer matches is initialized again. With
+ * isPrevInitDone init already completed since the boot, e.g. only the
+ * init container restarted, so faults and LEDs are left to board ms.
  */
-int BoardInitUtil::WarmInit()
+int BoardInitUtil::WarmInit(bool isPrevInitDone)
 {
+    RegCallerScope callerScope(REG_CALLER_INIT);
+
+    BootPhaseScope warmPhase(BOOT_PHASE_WARM_INIT);
+
     if (!IsHwEnv())
     {
         ILOG << "Running on sim or eval or hb only platform. "
@@ -230,6 +274,43 @@ int BoardInitUtil::WarmInit()
         return 0;
     }
 
+    boardMs::mezzBoardSpecType mezzBrdSpecId;
+
+    if (GetMezzBrdSpec(mezzBrdSpecId))
+    {
+        return -1;
+    }
+
+    InitFprintRecord fprint;
+
+    if (BoardInitFprint::getInstance().Get(fprint))
+    {
+        std::string changed;
+
+        if (!IsHostFprintSame(fprint, mezzBrdSpecId, changed))
+        {
+            ILOG << "Warm boot: " << changed << " changed since last init. Re-initializing board ...";
+
+            return ColdInit();
+        }
+
+        if (VerifyMezzFprint(fprint, mezzBrdSpecId))
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        ILOG << "Warm boot: no init fingerprint, taking hardware as is";
+    }
+
+    if (isPrevInitDone)
+    {
+        ILOG << "Init previously completed. Skipping fault checks";
+
+        return 0;
+    }
+
     /*
      * Warm boot: set Fru Active LED to FLASHING GREEN
      */
@@ -263,6 +344,241 @@ int BoardInitUtil::WarmInit()
     return 0;
 }
 
+void BoardInitUtil::SaveInitFprint(uint32 resetCause)
+{
+    if (!IsHwEnv())
+    {
+        return;
+    }
+
+    boardMs::mezzBoardSpecType mezzBrdSpecId;
+
+    if (GetMezzBrdSpec(mezzBrdSpecId))
+    {
+        return;
+    }
+
+    InitFprintRecord fprint;
+    memset(&fprint, 0, sizeof(fprint));
+
+    fprint.mResetCause  = resetCause;
+    fprint.mMezzSpec    = mezzBrdSpecId;
+    fprint.mFpgaVerHash = GetFpgaVerHash();
+
+    if (mspBrdDriver->GetMezzLatch(fprint.mMezzLatch))
+    {
+        ELOG << "Init fingerprint not saved, FPGA latch read failed";
+        return;
+    }
+
+    mspBrdDriver->CreateBcmDriver();
+
+    for (uint32 i = 0; i < boardMs::NUM_MEZZ_BRD_TYPES; i++)
+    {
+        boardMs::mezzBoardIdType brdId = static_cast<boardMs::mezzBoardIdType>(i);
+
+        if (!IsMezzInSpec(mezzBrdSpecId, brdId))
+        {
+            continue;
+        }
+
+        InitFprintMezz& mezz = fprint.maMezz[i];
+
+        mezz.mIsInit        = 1;
+        mezz.mSi5394CfgHash = BoardCommonDriver::GetClockCfgHash();
+
+        if (mspBrdDriver->GetBcmFwInfo(brdId, mezz.mGbFwVer, mezz.mGbFwCrc))
+        {
+            ELOG << "Init fingerprint not saved, MZ card: " << i << " gearbox firmware read failed";
+            return;
+        }
+    }
+
+    BoardInitFprint::getInstance().Save(fprint);
+
+    ILOG << "Init fingerprint saved";
+}
+
+/*
+ * A failed read is no evidence of change, and a re-init on one would
+ * hit hardware that may be carrying traffic. Reads are retried; one that
+ * still fails is logged and its part left as is.
+ */
+int BoardInitUtil::ReadFprint(const std::string& what, const std::function<int()>& read)
+{
+    int errCode = -1;
+
+    for (uint32 tries = 0; tries < boardMs::cInitFprintReadTries; tries++)
+    {
+        if (tries)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(boardMs::cInitFprintReadRetryMs));
+        }
+
+        if ((errCode = read()) >= 0)
+        {
+            return errCode;
+        }
+    }
+
+    ELOG << "Warm boot: " << what << " read failed " << boardMs::cInitFprintReadTries
+         << " times. Leaving it as is";
+
+    return errCode;
+}
+
+bool BoardInitUtil::IsHostFprintSame(const InitFprintRecord& fprint,
+                                     boardMs::mezzBoardSpecType mezzBrdSpecId,
+                                     std::string& changed)
+{
+    uint32 mezzLatch;
+
+    if (fprint.mMezzSpec != static_cast<uint32>(mezzBrdSpecId))
+    {
+        changed = "mezz spec";
+    }
+    else if (fprint.mFpgaVerHash != GetFpgaVerHash())
+    {
+        changed = "FPGA version";
+    }
+    else if (ReadFprint("FPGA latch", [&]() { return (mspBrdDriver->GetMezzLatch(mezzLatch) ? -1 : 0); }))
+    {
+        return true;
+    }
+    else if (mezzLatch != fprint.mMezzLatch)
+    {
+        changed = "mezz power or reset";
+    }
+    else
+    {
+        return true;
+    }
+
+    return false;
+}
+
+int BoardInitUtil::VerifyMezzFprint(const InitFprintRecord& fprint,
+                                    boardMs::mezzBoardSpecType mezzBrdSpecId)
+{
+    mspBrdDriver->CreateBcmDriver();
+
+    uint32 clockCfgHash = BoardCommonDriver::GetClockCfgHash();
+
+    for (uint32 i = 0; i < boardMs::NUM_MEZZ_BRD_TYPES; i++)
+    {
+        boardMs::mezzBoardIdType brdId = static_cast<boardMs::mezzBoardIdType>(i);
+
+        if (!IsMezzInSpec(mezzBrdSpecId, brdId))
+        {
+            continue;
+        }
+
+        const InitFprintMezz& mezz = fprint.maMezz[i];
+
+        std::string mzStr = "MZ card: " + std::to_string(i);
+
+        bool isClockSame = (mezz.mSi5394CfgHash == clockCfgHash);
+
+        if (isClockSame &&
+            ReadFprint(mzStr + " Si5394", [&]() { return mspBrdDriver->GetClockLock(brdId, isClockSame); }))
+        {
+            continue;
+        }
+
+        // Clock init resets the gearboxes too, so the whole mezz goes again
+        if (!isClockSame)
+        {
+            ILOG << "MZ card: " << i << " Si5394 config changed or not locked. Re-initializing mezz ...";
+
+            std::vector<boardMs::BoardFaultId> vFaults;
+
+            int retCode = InitMezzBoard(brdId, vFaults);
+
+            for (auto fid : vFaults)
+            {
+                mBoardInitFaultMap[fid]->CheckFaultCondition();
+            }
+
+            if (retCode || mspBrdDriver->InitBcmDriver(static_cast<boardMs::mezzBoardSpecType>(brdId)))
+            {
+                ELOG << "MZ card: " << i << " re-init failed";
+                return -1;
+            }
+
+            continue;
+        }
+
+        uint32 fwVer, fwCrc;
+
+        int fwErrCode = ReadFprint(mzStr + " gearbox firmware",
+                                   [&]() { return mspBrdDriver->GetBcmFwInfo(brdId, fwVer, fwCrc); });
+
+        if (fwErrCode < 0)
+        {
+            continue;
+        }
+
+        // Cores running different images count as changed
+        if (fwErrCode || (fwVer != mezz.mGbFwVer) || (fwCrc != mezz.mGbFwCrc))
+        {
+            ILOG << "MZ card: " << i << " gearbox firmware changed. Reloading ...";
+
+            // Cores still running the bundled image are skipped
+            if (mspBrdDriver->InitBcmDriver(static_cast<boardMs::mezzBoardSpecType>(brdId)))
+            {
+                ELOG << "MZ card: " << i << " gearbox reload failed";
+                return -1;
+            }
+
+            continue;
+        }
+
+        ILOG << "MZ card: " << i << " clock and gearbox unchanged since last init";
+    }
+
+    return 0;
+}
+
+int BoardInitUtil::GetMezzBrdSpec(boardMs::mezzBoardSpecType& mezzBrdSpecId)
+{
+    if (mEnvStr == "")
+    {
+        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_BOTH;
+    }
+    else if (mEnvStr == "bmz")
+    {
+        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_BTM;
+    }
+    else if (mEnvStr == "tmz")
+    {
+        mezzBrdSpecId = boardMs::MEZZ_BRD_SPEC_TOP;
+    }
+    else
+    {
+        INFN_LOG(SeverityLevel::error) << "Env Str unexpected for HW: "
+                        << mEnvStr
+                        << " Not sure how to initialize Mezz Boards";
+
+        return -1;
+    }
+
+    return 0;
+}
+
+bool BoardInitUtil::IsMezzInSpec(boardMs::mezzBoardSpecType mezzBrdSpecId,
+                                 boardMs::mezzBoardIdType brdId)
+{
+    return ((mezzBrdSpecId == boardMs::MEZZ_BRD_SPEC_BOTH) ||
+            (static_cast<uint32>(mezzBrdSpecId) == static_cast<uint32>(brdId)));
+}
+
+uint32 BoardInitUtil::GetFpgaVerHash()
+{
+    const char* pEnvStr = getenv(boardMs::cEnvStrVerFgpa.c_str());
+
+    return BoardInitFprint::Hash(std::string(pEnvStr ? pEnvStr : ""));
+}
+
 uint32 BoardInitUtil::GetResetCause()
 {
 #ifdef ARCH_x86
@@ -652,20 +968,24 @@ bool BoardInitUtil::CheckHstBrdFaults()
 
     bool isAllPass = true;
 
+    boardMs::DigitalInputSnapshot snapshot;
+    if (mspBrdDriver != nullptr)
+    {
+        mspBrdDriver->GetDigitalInputSnapshot(boardMs::MEZZ_BRD_SPEC_NONE, snapshot);
+    }
+
     for(auto itBrdFltId = mvHostBoardFaults.begin();
         itBrdFltId != mvHostBoardFaults.end();
         ++itBrdFltId)
     {
-        auto spBrdFaultFpga(
-            static_pointer_cast<boardMs::BoardFaultFpga>(
-                mBoardInitFaultMap[*itBrdFltId]));
+        auto& spBrdFault = mBoardInitFaultMap[*itBrdFltId];
 
         DLOG << "Checking Fault "
              << static_cast<uint32>(*itBrdFltId);
 
-        spBrdFaultFpga->CheckFaultCondition();
+        spBrdFault->CheckFaultCondition(snapshot);
 
-        if (spBrdFaultFpga->GetCondition() == boardMs::FAULT_SET)
+        if (spBrdFault->GetCondition() == boardMs::FAULT_SET)
         {
             ILOG << "Fault Set for FaultId: "
                            << static_cast<uint32>(*itBrdFltId);
@@ -694,17 +1014,24 @@ bool BoardInitUtil::CheckMezBrdFaults(boardMs::mezzBoardIdType boardId)
 
     bool isAllPass = true;
 
+    // Read this mezz IO Expander inputs once for all its faults
+    boardMs::DigitalInputSnapshot snapshot;
+    if (mspBrdDriver != nullptr)
+    {
+        mspBrdDriver->GetDigitalInputSnapshot(
+            static_cast<boardMs::mezzBoardSpecType>(boardId), snapshot);
+    }
+
     for( auto itBrdFltId = mvMezzBoardFaults[boardId].begin();
          itBrdFltId != mvMezzBoardFaults[boardId].end();
          ++itBrdFltId)
     {
-        auto spBrdFaultMezz(
-           static_pointer_cast<boardMs::BoardFaultMezzIoExp>(
-               mBoardInitFaultMap[*itBrdFltId]));
+        // at(): runs concurrently for both mezz during cold init
+        auto& spBrdFault = mBoardInitFaultMap.at(*itBrdFltId);
 
-        spBrdFaultMezz->CheckFaultCondition();
+        spBrdFault->CheckFaultCondition(snapshot);
 
-        if (spBrdFaultMezz->GetCondition() == boardMs::FAULT_SET)
+        if (spBrdFault->GetCondition() == boardMs::FAULT_SET)
         {
             isAllPass = false;
         }
@@ -790,79 +1117,127 @@ bool BoardInitUtil::IsHwEnv()
 
 int BoardInitUtil::InitMezzBoards()
 {
-    int retVal = 0;
+    bool isInitTop = ((mEnvStr == "") || (mEnvStr == "tmz"));
+    bool isInitBtm = ((mEnvStr == "") || (mEnvStr == "bmz"));
 
-    for(const auto brdId : {boardMs::MEZZ_BRD_TOP, boardMs::MEZZ_BRD_BTM})
+    if (!isInitTop)
     {
-        // Init bottom Mezz card
-        if((mEnvStr == "") ||
-           ((mEnvStr == "bmz") && (brdId == boardMs::MEZZ_BRD_BTM)) ||
-           ((mEnvStr == "tmz") && (brdId == boardMs::MEZZ_BRD_TOP)))
-        {
-            // Init IO Expander
-            if (mspBrdDriver->InitIoExp(brdId))
-            {
-                boardMs::BoardFaultId fid = boardMs::BMZ_IOEXP_ACCESS_FAIL;
-                if( brdId == boardMs::MEZZ_BRD_TOP )
-                {
-                    fid = boardMs::TMZ_IOEXP_ACCESS_FAIL;
-                }
-                mBoardInitFaultMap[fid]->CheckFaultCondition();
+        ILOG << "Skipping Mezz Card: " << static_cast<uint32>(boardMs::MEZZ_BRD_TOP)
+             << " init for env: " << mEnvStr;
+    }
 
-                ELOG << "MZ card: " << (uint32)brdId
-                     << " IO Expander Init Failed";
+    if (!isInitBtm)
+    {
+        ILOG << "Skipping Mezz Card: " << static_cast<uint32>(boardMs::MEZZ_BRD_BTM)
+             << " init for env: " << mEnvStr;
+    }
 
-                retVal = -1;
-                continue;   // allow other mezz to init
-            }
+    auto start = std::chrono::steady_clock::now();
 
-            // Init Si5394 Clock
-            if (mspBrdDriver->InitClock(brdId))
-            {
-                boardMs::BoardFaultId fid = boardMs::BMZ_I2C_CLKGEN_I2C_FAIL;
-                if( brdId == boardMs::MEZZ_BRD_TOP )
-                {
-                    fid = boardMs::TMZ_I2C_CLKGEN_I2C_FAIL;
-                }
-                mBoardInitFaultMap[fid]->CheckFaultCondition();
+    int retTop = 0;
+    int retBtm = 0;
 
-                ELOG << "MZ card: " << (uint32)brdId
-                     << " Si5394 Clock Init Failed";
+    // Faults found by each mezz pipeline, raised here once both are done
+    std::vector<boardMs::BoardFaultId> vTopFaults;
+    std::vector<boardMs::BoardFaultId> vBtmFaults;
 
-                retVal = -3;
-                continue;   // allow other mezz to init
-            }
+    if (isInitTop && isInitBtm)
+    {
+        // Mezz cards are on separate I2C and MDIO buses; init them concurrently
+        ILOG << "Init both Mezz cards concurrently";
 
-            // TODO: Temporary check of ADM1066 until problem is resolved
-            mspBrdDriver->CheckMezzPwrSeq(brdId);
+        boost::thread thrTop([&]{ retTop = InitMezzBoard(boardMs::MEZZ_BRD_TOP, vTopFaults); });
 
-            if (CheckMezBrdFaults(brdId) == false)
-            {
-                ELOG << "Mezz Board: " << static_cast<uint32>(brdId)
-                     << " Fault(s) detected. Aborting Init on this Mezz";
-                retVal = -2;
-                continue;
-            }
+        retBtm = InitMezzBoard(boardMs::MEZZ_BRD_BTM, vBtmFaults);
 
-            // Init Bcm
-            if (mspBrdDriver->InitBcm(brdId))
-            {
-                ELOG << "MZ card: " << static_cast<uint32>(brdId)
-                     << " BCM Init Failed";
-                retVal = -4;
-                continue;   // allow other mezz to init
-            }
+        thrTop.join();
+    }
+    else if (isInitTop)
+    {
+        retTop = InitMezzBoard(boardMs::MEZZ_BRD_TOP, vTopFaults);
+    }
+    else if (isInitBtm)
+    {
+        retBtm = InitMezzBoard(boardMs::MEZZ_BRD_BTM, vBtmFaults);
+    }
 
-            ILOG << "MZ card: " << static_cast<uint32>(brdId)
-                 << " Init Complete!!";
+    for (auto fid : vTopFaults)
+    {
+        mBoardInitFaultMap[fid]->CheckFaultCondition();
+    }
+
+    for (auto fid : vBtmFaults)
+    {
+        mBoardInitFaultMap[fid]->CheckFaultCondition();
+    }
+
+    uint32 durMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - start).count();
+
+    ILOG << "Mezz init done in " << durMs << " ms."
+         << " Top: " << retTop << " Bottom: " << retBtm;
+
+    // Bottom error reported first to match former top then bottom order
+    return (retBtm ? retBtm : retTop);
+}
+
+int BoardInitUtil::InitMezzBoard(boardMs::mezzBoardIdType brdId,
+                                 std::vector<boardMs::BoardFaultId>& vFaults)
+{
+    RegCallerScope callerScope(REG_CALLER_INIT);
+
+    // Init IO Expander
+    if (mspBrdDriver->InitIoExp(brdId))
+    {
+        boardMs::BoardFaultId fid = boardMs::BMZ_IOEXP_ACCESS_FAIL;
+        if( brdId == boardMs::MEZZ_BRD_TOP )
+        {
+            fid = boardMs::TMZ_IOEXP_ACCESS_FAIL;
         }
-        else
+        vFaults.push_back(fid);
+
+        ELOG << "MZ card: " << (uint32)brdId
+             << " IO Expander Init Failed";
+
+        return -1;
+    }
+
+    // Init Si5394 Clock
+    if (mspBrdDriver->InitClock(brdId))
+    {
+        boardMs::BoardFaultId fid = boardMs::BMZ_I2C_CLKGEN_I2C_FAIL;
+        if( brdId == boardMs::MEZZ_BRD_TOP )
         {
-            ILOG << "Skipping Mezz Card: " << static_cast<uint32>(brdId)
-                 << " init for env: " << mEnvStr;
+            fid = boardMs::TMZ_I2C_CLKGEN_I2C_FAIL;
         }
+        vFaults.push_back(fid);
+
+        ELOG << "MZ card: " << (uint32)brdId
+             << " Si5394 Clock Init Failed";
+
+        return -3;
     }
 
-    return retVal;
-}
+    // TODO: Temporary check of ADM1066 until problem is resolved
+    mspBrdDriver->CheckMezzPwrSeq(brdId);
 
+    if (CheckMezBrdFaults(brdId) == false)
+    {
+        ELOG << "Mezz Board: " << static_cast<uint32>(brdId)
+             << " Fault(s) detected. Aborting Init on this Mezz";
+        return -2;
+    }
+
+    // Init Bcm
+    if (mspBrdDriver->InitBcm(brdId))
+    {
+        ELOG << "MZ card: " << static_cast<uint32>(brdId)
+             << " BCM Init Failed";
+        return -4;
+    }
+
+    ILOG << "MZ card: " << static_cast<uint32>(brdId)
+         << " Init Complete!!";
+
+    return 0;
+}
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <vector>
 #include <map>
+#include <functional>
 
 #include "types.h"
 
@@ -19,6 +20,7 @@
 
 #include "board_defs.h"
 #include "board_fault_defs.h"
+#include "board_init_fprint.h"
 
 
 using namespace std;
@@ -44,9 +46,12 @@ public:
     int ColdInit();
 
     /*
-     * Warm init
+     * Warm init; re-initializes only what differs from the init fingerprint
      */
-    int WarmInit();
+    int WarmInit(bool isPrevInitDone);
+
+    // Record what a good init left the hardware running
+    void SaveInitFprint(uint32 resetCause);
 
     // Reset Cause
     uint32 GetResetCause();
@@ -70,8 +75,31 @@ private:
 
     bool IsHwEnv();
 
+    int GetMezzBrdSpec(boardMs::mezzBoardSpecType& mezzBrdSpecId);
+
+    static bool IsMezzInSpec(boardMs::mezzBoardSpecType mezzBrdSpecId,
+                             boardMs::mezzBoardIdType brdId);
+
+    static uint32 GetFpgaVerHash();
+
+    // Retries read while it fails; negative only when no try got through
+    static int ReadFprint(const std::string& what, const std::function<int()>& read);
+
+    // False only on a positive mismatch; unreadable hardware is left as is
+    bool IsHostFprintSame(const InitFprintRecord& fprint,
+                          boardMs::mezzBoardSpecType mezzBrdSpecId,
+                          std::string& changed);
+
+    // Re-init each mezz part read back different from fprint
+    int VerifyMezzFprint(const InitFprintRecord& fprint,
+                         boardMs::mezzBoardSpecType mezzBrdSpecId);
+
     int InitMezzBoards();
 
+    // Init pipeline of one mezz; faults found are returned in vFaults
+    int InitMezzBoard(boardMs::mezzBoardIdType brdId,
+                      std::vector<boardMs::BoardFaultId>& vFaults);
+
     void InitHstBrdFaults();
 
     void InitMezBrdFaults();
@@ -5,6 +5,8 @@
 
 #include "board_init_manager.h"
 #include "board_init_util.h"
+#include "board_journal.h"
+#include "board_boot_prof.h"
 #include "InfnLogger.h"
 #include "chm6/redis_adapter/application_servicer.h"
 #include "infinera/chm6/common/v2/board_init_state.pb.h"
@@ -22,10 +24,16 @@ BoardInitManager::BoardInitManager()
 
 int BoardInitManager::initialize()
 {
+    BoardBootProf& bootProf = BoardBootProf::getInstance();
+
+    bootProf.Begin(BOOT_PHASE_INIT);
+
     INFN_LOG(SeverityLevel::info) << " Starting connection to NorthBound";
 
     // NorthBound Connection Bring Up
+    bootProf.Begin(BOOT_PHASE_NB_CONN);
     initNbConnection(); // todo - should this be done first? Requires Redis up
+    bootProf.End(BOOT_PHASE_NB_CONN);
 
     mpBoardUtil->InitFaults();
 
@@ -42,11 +50,17 @@ int BoardInitManager::initialize()
 
     updateInitState(isOk);
 
+    bootProf.End(BOOT_PHASE_INIT);
+
+    bootProf.Save(mBootReason);
+
     return 0;
 }
 
 bool BoardInitManager::initHw()
 {
+    BootPhaseScope phase(BOOT_PHASE_INIT_HW);
+
     INFN_LOG(SeverityLevel::info) << "";
 
     getResetCause();
@@ -69,10 +83,8 @@ bool BoardInitManager::initHw()
     {
         INFN_LOG(SeverityLevel::info) << "Performing Warm Boot Init";
 
-        if (!mPrevInitStateDone)
-        {
-            errCode = mpBoardUtil->WarmInit();
-        }
+        // Fingerprint check is cheap; runs even when init completed before
+        errCode = mpBoardUtil->WarmInit(mPrevInitStateDone);
     }
 
     if (errCode != 0)
@@ -81,6 +93,8 @@ bool BoardInitManager::initHw()
         return false;
     }
 
+    mpBoardUtil->SaveInitFprint(mResetCauseBits);
+
     clrResetCause();
 
     return true;
@@ -243,6 +257,13 @@ void BoardInitManager::getResetCause()
     }
 
     INFN_LOG(SeverityLevel::info) << "Reboot Reason Enum: " << strBootReason;
+
+    // First record of this boot; board ms appends to the same journal
+    BoardJournal& journal = BoardJournal::getInstance();
+
+    journal.Open();
+    journal.Record(JOURNAL_REC_BOOT, mBootReason, mResetCauseBits);
+    journal.Flush(false);
 }
 
 void BoardInitManager::clrResetCause()
@@ -36,6 +36,8 @@ extern int SimDbgCmds(simBoardAda::SimBoardAdapter& adapter, BoardManager& manag
 
 extern int global_exit_code;
 
+const uint32 BoardManager::cPmStrobeLateMs;
+
 const std::string BoardManager::cEnvStrVerLc         = "chm6LcVersion";
 const std::string BoardManager::cEnvStrVerBaseOs     = "chm6BaseOsVersion";
 const std::string BoardManager::cEnvStrVerBaseInfra  = "chm6BaseInfraVersion";
@@ -43,6 +45,11 @@ const std::string BoardManager::cEnvStrVerBaseInfra  = "chm6BaseInfraVersion";
 const uint32 cWarmBootDelay = 20;
 const uint32 cColdBootDelay = 30;
 
+// Journal PM ids for DCO values, above the board PM ids
+const uint16 cJournalPmIdDcoDspTemp        = 0x100;
+const uint16 cJournalPmIdDcoPicTemp        = 0x101;
+const uint16 cJournalPmIdDcoModuleCaseTemp = 0x102;
+
 BoardManager::BoardManager(bool isSim, std::string aid, bool initDone)
     : mAid(aid)
     , mspAdapter(nullptr)
@@ -51,7 +58,26 @@ BoardManager::BoardManager(bool isSim, std::string aid, bool initDone)
     , mupBoardConfig(nullptr)
     , mupBoardState(nullptr)
     , mupBoardFault(nullptr)
-    , mupBoardPm(nullptr)
+    , mupPmBuilder(nullptr)
+    , mDcoDspTempSlot(BoardPmBuilder::cInvalidSlot)
+    , mDcoPicTempSlot(BoardPmBuilder::cInvalidSlot)
+    , mDcoModuleCaseTempSlot(BoardPmBuilder::cInvalidSlot)
+    , mupPmBinner(nullptr)
+    , mIsDcoCardFaultChanged(false)
+    , mIsBoardInitFaultChanged(false)
+    , mDcoHasFault(false)
+    , mNumStateDeltaSources(0)
+    , mIsStateFullSyncReq(false)
+    , mIsDeltaPublishEn(true)
+    , mNumStateWrites(0)
+    , mNumStateDeltaQueued(0)
+    , mNumFaultWrites(0)
+    , mNumPmStrobes(0)
+    , mNumPmStrobesMissed(0)
+    , mNumPmWrites(0)
+    , mNumPmStrobesLate(0)
+    , mMaxPmStrobeLatencyMs(0)
+    , mNumPmBinWrites(0)
     , mFirstState(true)
     , mFirstFault(true)
     , mFirstPm(true)
@@ -73,6 +99,8 @@ BoardManager::BoardManager(bool isSim, std::string aid, bool initDone)
 
     CreateDataCache();
 
+    BoardJournal::getInstance().Open();
+
     log << "CreateDataCache() done.";
     AddLog(__func__, __LINE__, log);
     INFN_LOG(SeverityLevel::info) << log.str();
@@ -459,23 +487,39 @@ void BoardManager::onResync(chm6_common::Chm6BoardInitState* pBrdState)
 
 void BoardManager::onPmStrobe()
 {
-    INFN_LOG(SeverityLevel::info) << "BoardManager::onPmStrobe() called";
+    INFN_LOG(SeverityLevel::debug) << "BoardManager::onPmStrobe() called";
 
     boost::unique_lock<boost::mutex> lock(mPm_strobe_cond_mutex);
+
+    mNumPmStrobes++;
+
+    if (mPm_strobe_ready)
+    {
+        // Previous strobe not sampled yet; its record is lost
+        mNumPmStrobesMissed++;
+        INFN_LOG(SeverityLevel::info) << "Pm strobe missed, total: " << mNumPmStrobesMissed;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &mPm_strobe_time);
     mPm_strobe_ready = true;
 
     mPm_strobe_cond.notify_one();
 
-    INFN_LOG(SeverityLevel::info) << "BoardManager::onPmStrobe() done";
+    INFN_LOG(SeverityLevel::debug) << "BoardManager::onPmStrobe() done";
 }
 
 void BoardManager::CollectFaults()
+{
+    CollectFaults(boardMs::cFaultEvtGrpAll);
+}
+
+void BoardManager::CollectFaults(uint32 eventGroups)
 {
     chm6_board::Chm6BoardFault boardFault;
 
     if (mIsBrdInitSuccess)
     {
-        mspAdapter->CheckFaults();
+        mspAdapter->CheckFaults(eventGroups);
     }
     else
     {
@@ -487,6 +531,7 @@ void BoardManager::CollectFaults()
     if (mFirstFault == true)
     {
         AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectCreate(*(mupBoardFault.get()));
+        mNumFaultWrites++;
 
         std::string fault_data;
         MessageToJsonString(*(mupBoardFault.get()), &fault_data);
@@ -498,7 +543,15 @@ void BoardManager::CollectFaults()
     {
         if (boardFault.has_hal())
         {
-            AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(*(mupBoardFault.get()));
+            if (mIsDeltaPublishEn)
+            {
+                AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(boardFault);
+            }
+            else
+            {
+                AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(*(mupBoardFault.get()));
+            }
+            mNumFaultWrites++;
 
             std::string fault_data;
             MessageToJsonString(boardFault, &fault_data);
@@ -506,11 +559,20 @@ void BoardManager::CollectFaults()
         }
     }
 
-    // TODO: remove later
-    CollectPm();
+    {
+        // Publish has_fault and any state changes from Redis callbacks
+        std::lock_guard<std::mutex> guard(mBoardStateLock);
+
+        FlushBoardStateDelta();
+    }
+}
+
+bool BoardManager::WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups)
+{
+    return mspAdapter->WaitFaultEvent(timeoutMs, eventGroups);
 }
 
-void BoardManager::CollectPm()
+void BoardManager::CollectPm(const struct timespec& strobeTime)
 {
     if (!mIsBrdInitSuccess)
     {
@@ -518,66 +580,83 @@ void BoardManager::CollectPm()
         return;
     }
 
-    mupBoardPm->mutable_hal()->clear_pm();
+    std::lock_guard<std::mutex> guard(mBoardPmLock);
+
+    // Strobe time decides the bin; close finished intervals before sampling
+    uint32 completedBins = mupPmBinner->Roll(strobeTime.tv_sec);
 
     // Copy dco pm first
     if (mDcoPm.has_dsp_temperature())
     {
-        std::string key("dsp_temperature");
-
-        hal_common::PmType_PmDataType data;
-
-        data.mutable_pm_data_name()->set_value(key);
-        data.mutable_float_val()->set_value(mDcoPm.dsp_temperature().value());
-        data.set_direction(hal_common::DIRECTION_NA);
-        data.set_location(hal_common::LOCATION_NA);
-
-        google::protobuf::MapPair<std::string, hal_common::PmType_PmDataType> dpair(key, data);
+        if (mDcoDspTempSlot == BoardPmBuilder::cInvalidSlot)
+        {
+            mDcoDspTempSlot = AddPmSlot("dsp_temperature");
+        }
 
-        mupBoardPm->mutable_hal()->mutable_pm()->insert(dpair);
+        SetPmValue(mDcoDspTempSlot, mDcoPm.dsp_temperature().value());
+        BoardJournal::getInstance().RecordPm(cJournalPmIdDcoDspTemp, mDcoPm.dsp_temperature().value());
     }
 
     if (mDcoPm.has_pic_temperature())
     {
-        std::string key("pic_temperature");
-
-        hal_common::PmType_PmDataType data;
-
-        data.mutable_pm_data_name()->set_value(key);
-        data.mutable_float_val()->set_value(mDcoPm.pic_temperature().value());
-        data.set_direction(hal_common::DIRECTION_NA);
-        data.set_location(hal_common::LOCATION_NA);
-
-        google::protobuf::MapPair<std::string, hal_common::PmType_PmDataType> dpair(key, data);
+        if (mDcoPicTempSlot == BoardPmBuilder::cInvalidSlot)
+        {
+            mDcoPicTempSlot = AddPmSlot("pic_temperature");
+        }
 
-        mupBoardPm->mutable_hal()->mutable_pm()->insert(dpair);
+        SetPmValue(mDcoPicTempSlot, mDcoPm.pic_temperature().value());
+        BoardJournal::getInstance().RecordPm(cJournalPmIdDcoPicTemp, mDcoPm.pic_temperature().value());
     }
 
     if (mDcoPm.has_module_case_temperature())
     {
-        std::string key("module_case_temperature");
+        if (mDcoModuleCaseTempSlot == BoardPmBuilder::cInvalidSlot)
+        {
+            mDcoModuleCaseTempSlot = AddPmSlot("module_case_temperature");
+        }
 
-        hal_common::PmType_PmDataType data;
+        SetPmValue(mDcoModuleCaseTempSlot, mDcoPm.module_case_temperature().value());
+        BoardJournal::getInstance().RecordPm(cJournalPmIdDcoModuleCaseTemp, mDcoPm.module_case_temperature().value());
+    }
 
-        data.mutable_pm_data_name()->set_value(key);
-        data.mutable_float_val()->set_value(mDcoPm.module_case_temperature().value());
-        data.set_direction(hal_common::DIRECTION_NA);
-        data.set_location(hal_common::LOCATION_NA);
+    // Add in board pm
+    UpdateBoardPm();
+
+    // Record carries the strobe time, not the sample time
+    mupPmBuilder->SetTimestamp(strobeTime.tv_sec, strobeTime.tv_nsec);
 
-        google::protobuf::MapPair<std::string, hal_common::PmType_PmDataType> dpair(key, data);
+    AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectStream(mupPmBuilder->GetPm());
+    mNumPmWrites++;
 
-        mupBoardPm->mutable_hal()->mutable_pm()->insert(dpair);
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    sint32 latencyMs = (now.tv_sec - strobeTime.tv_sec) * 1000
+                     + (now.tv_nsec - strobeTime.tv_nsec) / 1000000;
+
+    if (latencyMs > mMaxPmStrobeLatencyMs)
+    {
+        mMaxPmStrobeLatencyMs = latencyMs;
     }
 
-    // Add in board pm
-    UpdateBoardPm();
+    if (latencyMs > (sint32)cPmStrobeLateMs)
+    {
+        mNumPmStrobesLate++;
+        INFN_LOG(SeverityLevel::info) << "Pm published late: " << latencyMs << " ms after strobe";
+    }
 
-    AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectStream(*(mupBoardPm.get()));
+    for (uint32 i = 0; i < NUM_PM_BIN_INTERVALS; i++)
+    {
+        if (completedBins & (1 << i))
+        {
+            PublishPmBin(PmBinIntervalType(i));
+        }
+    }
 
     if (mFirstPm == true)
     {
         std::string pm_data;
-        MessageToJsonString(*(mupBoardPm.get()), &pm_data);
+        MessageToJsonString(mupPmBuilder->GetPm(), &pm_data);
         INFN_LOG(SeverityLevel::info) << "First update: " << pm_data;
 
         mFirstPm = false;
@@ -606,9 +685,14 @@ void BoardManager::CollectState()
 
         INFN_LOG(SeverityLevel::info) << "First update host board state: ";
 
-        SendBoardStateToRedis(boardState);
+        // First write carries the whole cache, including anything queued so far
+        mIsStateFullSyncReq = true;
+
+        QueueBoardStateDelta(boardState);
 
         mFirstState = false;
+
+        FlushBoardStateDelta();
     }
     else
     {
@@ -622,9 +706,11 @@ void BoardManager::CollectState()
 
             if (boardState.has_hal())
             {
-                SendBoardStateToRedis(boardState);
+                QueueBoardStateDelta(boardState);
             }
         }
+
+        FlushBoardStateDelta();
     }
 }
 
@@ -643,11 +729,26 @@ void BoardManager::DumpLog(std::ostream &os)
     {
         os << "BoardManager Log is not created!" << std::endl;
     }
+
+    os << std::endl << "BoardManager Trace:" << std::endl;
+
+    mTrace.Dump(os);
 }
 
 void BoardManager::DumpStatus(std::ostream &os, std::string cmd)
 {
     os << "BoardManager::DumpStatus(): cmd = " << cmd << std::endl;
+
+    if (cmd == "publish")
+    {
+        DumpPublishStats(os);
+    }
+    else if (cmd == "pm_bin")
+    {
+        std::lock_guard<std::mutex> guard(mBoardPmLock);
+
+        mupPmBinner->Dump(os);
+    }
 }
 
 void BoardManager::ResetLog( std::ostream &os )
@@ -661,6 +762,8 @@ void BoardManager::ResetLog( std::ostream &os )
         mpLog->ResetLog();
         os << "BoardManager Log has been reset!" << std::endl;
     }
+
+    mTrace.Reset();
 }
 
 void BoardManager::DumpBoardConfig(std::ostream& out)
@@ -707,7 +810,11 @@ void BoardManager::DumpBoardFault(std::ostream& out)
     out << "<<<<<<<<<<<<<<<<<<< DcoCardFault >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
 
     string data1;
-    MessageToJsonString(mDcoCardFault, &data1);
+    {
+        std::lock_guard<std::mutex> guard(mFaultInputLock);
+
+        MessageToJsonString(mDcoCardFault, &data1);
+    }
 
     Json::Value root1;
 
@@ -721,7 +828,13 @@ void BoardManager::DumpBoardPm(std::ostream& out)
     out << "<<<<<<<<<<<<<<<<<<< BoardManager.DumpBoardPm >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
 
     string data;
-    MessageToJsonString(*(mupBoardPm.get()), &data);
+    {
+        std::lock_guard<std::mutex> guard(mBoardPmLock);
+
+        MessageToJsonString(mupPmBuilder->GetPm(), &data);
+
+        mupPmBuilder->Dump(out);
+    }
 
     Json::Value root;
 
@@ -741,6 +854,60 @@ void BoardManager::DumpBoardPm(std::ostream& out)
     out << Json::StyledWriter().write(root1) << std::endl;
 }
 
+void BoardManager::DumpJournal(std::ostream& out, std::string ring, uint32 numRecs)
+{
+    BoardJournalRingType ringType = (ring == "pm") ? JOURNAL_RING_PM : JOURNAL_RING_EVENT;
+
+    auto idToName = [](uint16 type, uint16 id) -> std::string
+    {
+        switch (type)
+        {
+            case JOURNAL_REC_BOOT:
+                return chm6_common::BootReason_Name((chm6_common::BootReason)id);
+            case JOURNAL_REC_HOST_ACTION:
+            case JOURNAL_REC_DCO_ACTION:
+                return hal_common::BoardAction_Name((hal_common::BoardAction)id);
+            case JOURNAL_REC_PM:
+                if (id < boardMs::MAX_PM_ID_NUM)
+                {
+                    return boardMs::Chm6BoardPm::BoardPmIdToName((boardMs::BoardPmId)id);
+                }
+                else if (id == cJournalPmIdDcoDspTemp)
+                {
+                    return std::string("dsp_temperature");
+                }
+                else if (id == cJournalPmIdDcoPicTemp)
+                {
+                    return std::string("pic_temperature");
+                }
+                else if (id == cJournalPmIdDcoModuleCaseTemp)
+                {
+                    return std::string("module_case_temperature");
+                }
+                return std::string("");
+            default:
+                return std::string("");
+        }
+    };
+
+    BoardJournal::getInstance().Dump(out, ringType, numRecs, idToName);
+}
+
+void BoardManager::DumpBootProf(std::ostream& out, uint32 numBoots)
+{
+    auto reasonToName = [](uint32 reason) -> std::string
+    {
+        return chm6_common::BootReason_Name((chm6_common::BootReason)reason);
+    };
+
+    BoardBootProf::getInstance().Dump(out, numBoots, reasonToName);
+}
+
+void BoardManager::DumpInitFprint(std::ostream& out)
+{
+    BoardInitFprint::getInstance().Dump(out);
+}
+
 // Reboot
 void BoardManager::SetRestartWarm(std::ostream& out)
 {
@@ -840,28 +1007,23 @@ void BoardManager::CreateDataCache()
     MessageToJsonString(*(mupBoardFault.get()), &fault_data);
     INFN_LOG(SeverityLevel::info) << fault_data;
 
+    for (uint32 id = 0; id < boardMs::MAX_BOARD_FAULT_ID_NUM; ++id)
+    {
+        maBoardFaultCache[id].mName = Chm6BoardFault::BoardFaultIdToName((boardMs::BoardFaultId)id);
+
+        mBoardFaultIdByName[maBoardFaultCache[id].mName] = (boardMs::BoardFaultId)id;
+    }
+
     /* =========================
      * message Chm6BoardPm
      * =========================
      */
-    mupBoardPm = std::make_unique<chm6_board::Chm6BoardPm>();
+    mupPmBuilder = std::make_unique<BoardPmBuilder>(mAid);
 
-    /*
-     * message Chm6BoardPm
-     * .infinera.chm6.common.vx.BasePm base_pm = 1;
-     */
-    chm6_common::BasePm* base_pm = mupBoardPm->mutable_base_pm();
-
-    // .google.protobuf.StringValue config_id = 1;
-    base_pm->mutable_config_id()->set_value(mAid);
-    // .google.protobuf.Timestamp timestamp = 2;
-    base_pm->mutable_timestamp()->set_seconds(time(NULL));
-    base_pm->mutable_timestamp()->set_nanos(0);
-    // .google.protobuf.BoolValue mark_for_delete = 3;
-    base_pm->mutable_mark_for_delete()->set_value(false);
+    mupPmBinner = std::make_unique<BoardPmBinner>();
 
     std::string pm_data;
-    MessageToJsonString(*(mupBoardPm.get()), &pm_data);
+    MessageToJsonString(mupPmBuilder->GetPm(), &pm_data);
     INFN_LOG(SeverityLevel::info) << pm_data;
 }
 
@@ -975,7 +1137,14 @@ void BoardManager::CreateStateCollector()
 
     int faultInterval = 1; // 1 seconds - TBD
 
-    mupCollector = std::make_unique<BoardStateCollector>(*this, name, stateInterval,faultInterval, true);
+    int faultSafetyNetInterval = 5; // seconds, event mode only
+
+    bool isFaultEventMode = mspAdapter->IsFaultEventCapable();
+
+    INFN_LOG(SeverityLevel::info) << "Fault collection mode: " << (isFaultEventMode ? "event" : "poll");
+
+    mupCollector = std::make_unique<BoardStateCollector>(*this, name, stateInterval, faultInterval, true,
+                                                         isFaultEventMode, faultSafetyNetInterval);
 
     mupCollector->Collect();
 }
@@ -985,10 +1154,6 @@ void BoardManager::UpdateBoardFaults(chm6_board::Chm6BoardFault& boardFault)
     // Get faults from adapter layer
     boardMs::board_fault_ptr_vec& adapterBoardFaults = mspAdapter->GetBoardFault();
 
-    bool boardHasFault = false;
-
-    std::map<std::string, bool> mapFaultSimEn;
-
     /*
      * message Chm6BoardFault
      * .infinera.hal.common.vx.FaultType hal = 2;
@@ -998,161 +1163,124 @@ void BoardManager::UpdateBoardFaults(chm6_board::Chm6BoardFault& boardFault)
 
     for (boardMs::board_fault_vec_itr itr = adapterBoardFaults.begin(); itr != adapterBoardFaults.end(); itr++)
     {
-        // fault name as key
-        std::string key((*itr).GetName());
+        uint32 id = (*itr).GetFaultId();
 
-        if ((*itr).GetCondition() != boardMs::FAULT_UNKNOWN)
+        if (id < boardMs::MAX_BOARD_FAULT_ID_NUM)
         {
-            bool newValue = BoardManagerUtil::MsFaultConditionToProtoFaultCondition((*itr).GetCondition());
-
-            wrapper::Bool newFaultValue = BoardManagerUtil::MsFaultConditionToInfnProtoFaultCondition((*itr).GetCondition());
-
-            if ((*itr).GetSimEnable() == true)
-            {
-                mapFaultSimEn.insert(std::make_pair(key, true));
-            }
+            maBoardFaultCache[id].mAdapterCondition = (*itr).GetCondition();
+            maBoardFaultCache[id].mIsSimEn          = (*itr).GetSimEnable();
+        }
+    }
 
-            // Compare value with cache
-            if ( (((*boardFaultMap)[key].has_value() == false) || ((*boardFaultMap)[key].value().value() != newValue))
-              || ((*boardFaultMap)[key].fault_value() != newFaultValue))
-            {
-                INFN_LOG(SeverityLevel::info) << "Board Fault Condition change detected for fault: " << key  <<
-                                  " condition: " << Chm6BoardFault::BoardFltCondiToStr((*itr).GetCondition());
+    std::lock_guard<std::mutex> guard(mFaultInputLock);
 
-                //Update cache
-                // .google.protobuf.StringValue fault_name = 1;
-                (*boardFaultMap)[key].mutable_fault_name()->set_value(key);
-                // .google.protobuf.BoolValue value = 2;
-                (*boardFaultMap)[key].mutable_value()->set_value(newValue);
+    // Board Init Faults
+    if (mIsBoardInitFaultChanged)
+    {
+        UpdateBoardInitFaultCache();
 
-                (*boardFaultMap)[key].set_direction(hal_common::DIRECTION_NA);
-                (*boardFaultMap)[key].set_location(hal_common::LOCATION_NA);
-                (*boardFaultMap)[key].set_fault_value(newFaultValue);
+        mIsBoardInitFaultChanged = false;
+    }
 
-                // Save the change
-                hal_common::FaultType_FaultDataType fdata;
+    bool boardHasFault = false;
 
-                fdata.mutable_fault_name()->set_value(key);
-                fdata.mutable_value()->set_value(newValue);
-                fdata.set_direction(hal_common::DIRECTION_NA);
-                fdata.set_location(hal_common::LOCATION_NA);
-                fdata.set_fault_value(newFaultValue);
+    for (uint32 id = 0; id < boardMs::MAX_BOARD_FAULT_ID_NUM; ++id)
+    {
+        BoardFaultCacheEntry& entry = maBoardFaultCache[id];
 
-                google::protobuf::MapPair<std::string, hal_common::FaultType_FaultDataType> fpair(key, fdata);
-                boardFault.mutable_hal()->mutable_fault()->insert(fpair);
-            }
+        uint8 newCondition = MergeFaultCondition(entry);
 
-            // Update Chm6BoardState
-            boardHasFault = boardHasFault || newValue;
+        // Unknown keeps the last published condition
+        if ((newCondition != boardMs::FAULT_UNKNOWN) && (newCondition != entry.mCondition))
+        {
+            entry.mCondition = newCondition;
+            mBoardFaultDirty.set(id);
         }
+
+        // Update Chm6BoardState
+        boardHasFault = boardHasFault || (entry.mCondition == boardMs::FAULT_SET);
     }
 
-    // Add in Chm6DcoCardFault
-    if (mDcoCardFault.has_hal())
+    if (mBoardFaultDirty.any())
     {
-        const google::protobuf::Map< std::string, hal_common::FaultType_FaultDataType >& dcoFaultMap = mDcoCardFault.mutable_hal()->fault();
-
-        for (auto iter = dcoFaultMap.cbegin(); iter != dcoFaultMap.cend(); ++iter)
+        for (uint32 id = 0; id < boardMs::MAX_BOARD_FAULT_ID_NUM; ++id)
         {
-            if (iter->second.has_fault_name() && iter->second.has_value())
+            if (!mBoardFaultDirty.test(id))
             {
-                std::string key = iter->first;
-
-                if ( ((*boardFaultMap)[key].has_value() == false) || ((*boardFaultMap)[key].value().value() != iter->second.value().value())
-                  || ((*boardFaultMap)[key].fault_value() != iter->second.fault_value()))
-                {
-                    //Update cache
-                    // .google.protobuf.StringValue fault_name = 1;
-                    (*boardFaultMap)[key].mutable_fault_name()->set_value(iter->second.fault_name().value());
-                    // .google.protobuf.BoolValue value = 2;
-                    (*boardFaultMap)[key].mutable_value()->set_value(iter->second.value().value());
+                continue;
+            }
 
-                    (*boardFaultMap)[key].set_direction(iter->second.direction());
-                    (*boardFaultMap)[key].set_location(iter->second.location());
+            BoardFaultCacheEntry& entry = maBoardFaultCache[id];
 
-                    (*boardFaultMap)[key].set_fault_value(iter->second.fault_value());
+            boardMs::faultConditionType condition = (boardMs::faultConditionType)entry.mCondition;
 
-                    // Save the change
-                    hal_common::FaultType_FaultDataType fdata;
+            INFN_LOG(SeverityLevel::info) << "Board Fault Condition change detected for fault: " << entry.mName  <<
+                              " condition: " << Chm6BoardFault::BoardFltCondiToStr(condition);
 
-                    fdata.mutable_fault_name()->set_value(iter->second.fault_name().value());
-                    fdata.mutable_value()->set_value(iter->second.value().value());
-                    fdata.set_direction(iter->second.direction());
-                    fdata.set_location(iter->second.location());
-                    fdata.set_fault_value(iter->second.fault_value());
+            BoardJournal::getInstance().Record(JOURNAL_REC_FAULT, id, condition);
 
-                    google::protobuf::MapPair<std::string, hal_common::FaultType_FaultDataType> fpair(key, fdata);
-                    boardFault.mutable_hal()->mutable_fault()->insert(fpair);
-                }
+            if (entry.mpFaultData == nullptr)
+            {
+                // First change for this fault; map entries are not erased so the pointer stays valid
+                entry.mpFaultData = &(*boardFaultMap)[entry.mName];
 
-                // Update Chm6BoardState
-                boardHasFault = boardHasFault || iter->second.value().value();
+                // .google.protobuf.StringValue fault_name = 1;
+                entry.mpFaultData->mutable_fault_name()->set_value(entry.mName);
+                entry.mpFaultData->set_direction(hal_common::DIRECTION_NA);
+                entry.mpFaultData->set_location(hal_common::LOCATION_NA);
             }
+
+            //Update cache
+            // .google.protobuf.BoolValue value = 2;
+            entry.mpFaultData->mutable_value()->set_value(BoardManagerUtil::MsFaultConditionToProtoFaultCondition(condition));
+            entry.mpFaultData->set_fault_value(BoardManagerUtil::MsFaultConditionToInfnProtoFaultCondition(condition));
+
+            // Save the change
+            (*boardFault.mutable_hal()->mutable_fault())[entry.mName] = *entry.mpFaultData;
         }
+
+        mBoardFaultDirty.reset();
     }
 
-    // Board Init Faults
-    if (mBoardInitFault.fault_size() != 0)
+    // Add in Chm6DcoCardFault
+    if (mIsDcoCardFaultChanged)
     {
-        const ::google::protobuf::Map<std::string, hal_common::FaultType_FaultDataType>&
-            mapInitFlt = mBoardInitFault.fault();
+        mDcoHasFault = false;
 
-        for(auto &it : mapInitFlt)
-        {
-            std::string key(it.first);
+        const google::protobuf::Map< std::string, hal_common::FaultType_FaultDataType >& dcoFaultMap = mDcoCardFault.hal().fault();
 
-            if ( (((*boardFaultMap)[key].has_value() == false) || ((*boardFaultMap)[key].value().value() != it.second.value().value()))
-              || ((*boardFaultMap)[key].fault_value() != it.second.fault_value()) )
+        for (auto iter = dcoFaultMap.cbegin(); iter != dcoFaultMap.cend(); ++iter)
+        {
+            if (iter->second.has_fault_name() && iter->second.has_value())
             {
-                // check for fault sim override before processing board init fault
-                std::map<std::string, bool>::iterator itFaultSim = mapFaultSimEn.find(key);
-                if (itFaultSim != mapFaultSimEn.end())
+                hal_common::FaultType_FaultDataType& cacheData = (*boardFaultMap)[iter->first];
+
+                if ( (cacheData.has_value() == false) || (cacheData.value().value() != iter->second.value().value())
+                  || (cacheData.fault_value() != iter->second.fault_value()))
                 {
-                    if (itFaultSim->second == true)
-                    {
-                        INFN_LOG(SeverityLevel::debug) << "Board Fault Sim Enable Overriding Board Init Fault State ";
+                    //Update cache
+                    cacheData.CopyFrom(iter->second);
 
-                        continue;
-                    }
+                    // Save the change
+                    (*boardFault.mutable_hal()->mutable_fault())[iter->first] = cacheData;
                 }
 
-                // todo: demote this print
-                INFN_LOG(SeverityLevel::info) << "BoardInit Fault detected for fault: " << key;
-
-                //Update cache
-                // .google.protobuf.StringValue fault_name = 1;
-                (*boardFaultMap)[key].mutable_fault_name()->set_value(it.second.fault_name().value());
-                // .google.protobuf.BoolValue value = 2;
-                (*boardFaultMap)[key].mutable_value()->set_value(it.second.value().value());
-
-                (*boardFaultMap)[key].set_direction(hal_common::DIRECTION_NA);
-                (*boardFaultMap)[key].set_location(hal_common::LOCATION_NA);
-
-                (*boardFaultMap)[key].set_fault_value(it.second.fault_value());
-
-                // Save the change
-                hal_common::FaultType_FaultDataType fdata;
-
-                fdata.mutable_fault_name()->set_value(it.second.fault_name().value());
-                fdata.mutable_value()->set_value(it.second.value().value());
-                fdata.set_direction(hal_common::DIRECTION_NA);
-                fdata.set_location(hal_common::LOCATION_NA);
-                fdata.set_fault_value(it.second.fault_value());
-
-                google::protobuf::MapPair<std::string, hal_common::FaultType_FaultDataType> fpair(key, fdata);
-                boardFault.mutable_hal()->mutable_fault()->insert(fpair);
+                mDcoHasFault = mDcoHasFault || iter->second.value().value();
             }
-
-            // Update Chm6BoardState
-            boardHasFault = boardHasFault || it.second.value().value();
         }
+
+        mIsDcoCardFaultChanged = false;
     }
 
+    boardHasFault = boardHasFault || mDcoHasFault;
+
     /*
      * message Chm6BoardState
      * .infinera.hal.chm6.vx.BoardState.OperationalState hal = 2;
      * .infinera.hal.board.vx.BoardState.OperationalState common_state = 1;
      */
+    std::lock_guard<std::mutex> stateGuard(mBoardStateLock);
+
     hal_board::BoardState_OperationalState* common_state = mupBoardState->mutable_hal()->mutable_common_state();
 
     // .google.protobuf.BoolValue has_fault = 9;
@@ -1175,6 +1303,14 @@ void BoardManager::UpdateBoardFaults(chm6_board::Chm6BoardFault& boardFault)
         common_state->mutable_has_fault()->set_value(boardHasFault);
 
         common_state->set_board_has_fault(boardHasFaultVal);
+
+        // Save change
+        chm6_board::Chm6BoardState boardState;
+
+        boardState.mutable_hal()->mutable_common_state()->mutable_has_fault()->set_value(boardHasFault);
+        boardState.mutable_hal()->mutable_common_state()->set_board_has_fault(boardHasFaultVal);
+
+        QueueBoardStateDelta(boardState);
     }
 
     /*
@@ -1186,7 +1322,63 @@ void BoardManager::UpdateBoardFaults(chm6_board::Chm6BoardFault& boardFault)
     base_fault->mutable_timestamp()->set_seconds(time(NULL));
     base_fault->mutable_timestamp()->set_nanos(0);
 
-    boardFault.mutable_base_fault()->CopyFrom(*base_fault);
+    if (boardFault.has_hal())
+    {
+        boardFault.mutable_base_fault()->CopyFrom(*base_fault);
+    }
+}
+
+void BoardManager::UpdateBoardInitFaultCache()
+{
+    for (uint32 id = 0; id < boardMs::MAX_BOARD_FAULT_ID_NUM; ++id)
+    {
+        maBoardFaultCache[id].mInitCondition = boardMs::FAULT_UNKNOWN;
+    }
+
+    const ::google::protobuf::Map<std::string, hal_common::FaultType_FaultDataType>&
+        mapInitFlt = mBoardInitFault.fault();
+
+    for(auto &it : mapInitFlt)
+    {
+        auto itId = mBoardFaultIdByName.find(it.first);
+
+        if (itId == mBoardFaultIdByName.end())
+        {
+            INFN_LOG(SeverityLevel::error) << "Unknown BoardInit Fault: " << it.first;
+            continue;
+        }
+
+        bool isSet = (it.second.fault_value() == wrapper::BOOL_UNSPECIFIED) ? it.second.value().value()
+                                                                            : (it.second.fault_value() == wrapper::BOOL_TRUE);
+
+        if (isSet)
+        {
+            INFN_LOG(SeverityLevel::info) << "BoardInit Fault detected for fault: " << it.first;
+        }
+
+        maBoardFaultCache[itId->second].mInitCondition = isSet ? boardMs::FAULT_SET : boardMs::FAULT_CLEAR;
+    }
+}
+
+uint8 BoardManager::MergeFaultCondition(const BoardFaultCacheEntry& entry)
+{
+    // Fault sim overrides board init fault state
+    if (entry.mIsSimEn)
+    {
+        return entry.mAdapterCondition;
+    }
+
+    if ((entry.mAdapterCondition == boardMs::FAULT_SET) || (entry.mInitCondition == boardMs::FAULT_SET))
+    {
+        return boardMs::FAULT_SET;
+    }
+
+    if ((entry.mAdapterCondition == boardMs::FAULT_CLEAR) || (entry.mInitCondition == boardMs::FAULT_CLEAR))
+    {
+        return boardMs::FAULT_CLEAR;
+    }
+
+    return boardMs::FAULT_UNKNOWN;
 }
 
 void BoardManager::UpdateBoardPm()
@@ -1196,43 +1388,32 @@ void BoardManager::UpdateBoardPm()
         // Get pm from adapter
         boardMs::board_pm_ptr_vec& adapterBoardPm = mspAdapter->GetBoardPm();
 
-        /*
-         * message Chm6BoardPm
-         * .infinera.hal.common.vx.PmType hal = 2;
-         */
-        // map<string, .infinera.hal.common.vx.PmType.PmDataType> pm = 3;
-        google::protobuf::Map< std::string, hal_common::PmType_PmDataType >* cacheMap = mupBoardPm->mutable_hal()->mutable_pm();
-
-        for (boardMs::board_pm_vec_itr itr = adapterBoardPm.begin(); itr != adapterBoardPm.end(); itr++)
+        // Adapter pm list is fixed; entries are created on the first pass
+        if (mvBoardPmSlots.size() != adapterBoardPm.size())
         {
-            std::string key((*itr).mName);
-            float64 value = (*itr).mValue;
+            mvBoardPmSlots.clear();
 
-            // Update cache
-            hal_common::PmType_PmDataType data;
-
-            // .google.protobuf.StringValue pm_data_name = 1;
-            data.mutable_pm_data_name()->set_value(key);
-            // .google.protobuf.FloatValue float_val = 7;
-            data.mutable_float_val()->set_value(value);
+            for (boardMs::board_pm_vec_itr itr = adapterBoardPm.begin(); itr != adapterBoardPm.end(); itr++)
+            {
+                mvBoardPmSlots.push_back(AddPmSlot((*itr).mName));
+            }
+        }
 
-            data.set_direction(hal_common::DIRECTION_NA);
-            data.set_location(hal_common::LOCATION_NA);
+        uint32 i = 0;
 
-            google::protobuf::MapPair<std::string, hal_common::PmType_PmDataType> dpair(key, data);
+        for (boardMs::board_pm_vec_itr itr = adapterBoardPm.begin(); itr != adapterBoardPm.end(); itr++, i++)
+        {
+            // No current sample, e.g. mezz absent or sensor not read yet
+            if (!(*itr).mIsValid)
+            {
+                continue;
+            }
 
-            cacheMap->insert(dpair);
+            // Update cache
+            SetPmValue(mvBoardPmSlots[i], (*itr).mValue);
+            BoardJournal::getInstance().RecordPm((*itr).mId, (*itr).mValue);
         }
     }
-
-    /*
-     * message Chm6BoardPm
-     * .infinera.chm6.common.vx.BasePm base_pm = 1;
-     */
-    chm6_common::BasePm* base_pm = mupBoardPm->mutable_base_pm();
-    // .google.protobuf.Timestamp timestamp = 2;
-    base_pm->mutable_timestamp()->set_seconds(time(NULL));
-    base_pm->mutable_timestamp()->set_nanos(0);
 }
 
 void BoardManager::UpdateEqptStates(chm6_board::Chm6BoardState& boardState)
@@ -1343,7 +1524,13 @@ void BoardManager::UpdateLedStates(chm6_board::Chm6BoardState& boardState)
     // map<uint32, .infinera.hal.common.v2.PortLed> port_led_states = 16;
     google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >* cachePortLedStates = common_state->mutable_port_led_states();
 
-    boardMs::port_led_ptr_vec& adaPortLedStates = mspAdapter->GetPortLedStates();
+    // Port and line LEDs share one register pass
+    boardMs::port_led_ptr_vec* pAdaPortLedStates = nullptr;
+    boardMs::line_led_ptr_vec* pAdaLineLedStates = nullptr;
+
+    mspAdapter->GetMezzLedStates(pAdaPortLedStates, pAdaLineLedStates);
+
+    boardMs::port_led_ptr_vec& adaPortLedStates = *pAdaPortLedStates;
 
     for (boardMs::port_led_vec_itr itr = adaPortLedStates.begin(); itr != adaPortLedStates.end(); itr++)
     {
@@ -1379,7 +1566,7 @@ void BoardManager::UpdateLedStates(chm6_board::Chm6BoardState& boardState)
     // map<uint32, .infinera.hal.common.v2.LineLed> line_led_states = 17;
     google::protobuf::Map< google::protobuf::uint32, hal_common::LineLed >* cacheLineLedStates = common_state->mutable_line_led_states();
 
-    boardMs::line_led_ptr_vec& adaLineLedStates = mspAdapter->GetLineLedStates();
+    boardMs::line_led_ptr_vec& adaLineLedStates = *pAdaLineLedStates;
 
     for (line_led_vec_itr itr = adaLineLedStates.begin(); itr != adaLineLedStates.end(); itr++)
     {
@@ -1547,7 +1734,7 @@ void BoardManager::UpdateDcoSyncReady()
         // Save change
         boardState.mutable_hal()->mutable_common_state()->set_sync_ready(mDcoSyncReady);
 
-        SendBoardStateToRedis(boardState);
+        QueueBoardStateDelta(boardState);
     }
 }
 
@@ -1584,12 +1771,18 @@ void BoardManager::UpdateTomPresenceMap()
             boardState.mutable_hal()->mutable_common_state()->mutable_tom_presence_map()->set_value(mTomPresenceMap.mutable_tom_presence_map()->value());
         }
     }
-    else
+    else if (mupBoardState->mutable_hal()->mutable_common_state()->has_tom_presence_map())
     {
-        mupBoardState->mutable_hal()->mutable_common_state()->release_tom_presence_map();
+        mupBoardState->mutable_hal()->mutable_common_state()->clear_tom_presence_map();
+
+        // Removal cannot be carried by a delta
+        mIsStateFullSyncReq = true;
     }
 
-    SendBoardStateToRedis(boardState);
+    if (boardState.has_hal())
+    {
+        QueueBoardStateDelta(boardState);
+    }
 }
 
 void BoardManager::UpdateDcoCapabilities()
@@ -1611,7 +1804,7 @@ void BoardManager::UpdateDcoCapabilities()
 
         boardState.mutable_hal()->mutable_dco_capabilities()->CopyFrom(mDcoCapabilities);
 
-        SendBoardStateToRedis(boardState);
+        QueueBoardStateDelta(boardState);
     }
 }
 
@@ -1653,7 +1846,7 @@ void BoardManager::UpdateFanControlFlags()
 
     if (boardState.has_hal())
     {
-        SendBoardStateToRedis(boardState);
+        QueueBoardStateDelta(boardState);
     }
 }
 
@@ -1701,12 +1894,15 @@ int  BoardManager::HandleBoardConfig(chm6_board::Chm6BoardConfig* boardCfgMsg)
                 HandleLedLocationTest(newConfig.led_location_test().value());
             }
 
+            // Port and line LEDs are collected, then applied as one batch
+            boardMs::MezzLedStates mezzLedStates;
+
             // map<uint32, .infinera.hal.common.vx.PortLed> port_leds = 9;
             const google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >& new_port_leds = newConfig.port_leds();
 
             if (newConfig.port_leds_size() != 0)
             {
-                HandlePortLeds(new_port_leds);
+                HandlePortLeds(new_port_leds, mezzLedStates);
             }
 
             // map<uint32, .infinera.hal.common.vx.LineLed> line_leds = 10;
@@ -1714,7 +1910,12 @@ int  BoardManager::HandleBoardConfig(chm6_board::Chm6BoardConfig* boardCfgMsg)
 
             if (newConfig.line_leds_size() != 0)
             {
-                HandleLineLeds(new_line_leds);
+                HandleLineLeds(new_line_leds, mezzLedStates);
+            }
+
+            if ((newConfig.port_leds_size() != 0) || (newConfig.line_leds_size() != 0))
+            {
+                HandleMezzLeds(mezzLedStates);
             }
         }
 
@@ -1756,6 +1957,8 @@ int BoardManager::HandleHostCardAction(hal_common::BoardAction hostCardAction)
     AddLog(__func__, __LINE__, log);
     INFN_LOG(SeverityLevel::info) << log.str();
 
+    BoardJournal::getInstance().Record(JOURNAL_REC_HOST_ACTION, hostCardAction);
+
     mHostBoardAction = hostCardAction;
 
     if (mHostBoardAction != hal_common::BOARD_ACTION_UNSPECIFIED)
@@ -1812,6 +2015,8 @@ int BoardManager::HandleDcoCardAction(hal_common::BoardAction dcoCardAction)
     AddLog(__func__, __LINE__, log);
     INFN_LOG(SeverityLevel::info) << log.str();
 
+    BoardJournal::getInstance().Record(JOURNAL_REC_DCO_ACTION, dcoCardAction);
+
     if (dcoCardAction == hal_common::BoardAction::BOARD_ACTION_RESTART_COLD)
     {
         log << " Start DCO RESTART_COLD delay: " << boardMs::cColdRestartDcoDelaySec;
@@ -1827,10 +2032,8 @@ int BoardManager::HandleDcoCardAction(hal_common::BoardAction dcoCardAction)
 
 int BoardManager::HandleFaultLed(hal_common::LedState state)
 {
-    std::ostringstream  log;
-    log << "Set  FruFaultLed: " << state;
-    AddLog(__func__, __LINE__, log);
-    INFN_LOG(SeverityLevel::info) << log.str();
+    BRD_TRACE(mTrace, "Set FruFaultLed: %d", state);
+    INFN_LOG(SeverityLevel::info) << "Set  FruFaultLed: " << state;
 
     boardMs::LedStateType adaState = BoardManagerUtil::ProtoLedStateToMsLedState(state);
 
@@ -1841,10 +2044,8 @@ int BoardManager::HandleFaultLed(hal_common::LedState state)
 
 int BoardManager::HandleActiveLed(hal_common::LedState state)
 {
-    std::ostringstream  log;
-    log << "Set  FruActiveLed: " << state;
-    AddLog(__func__, __LINE__, log);
-    INFN_LOG(SeverityLevel::info) << log.str();
+    BRD_TRACE(mTrace, "Set FruActiveLed: %d", state);
+    INFN_LOG(SeverityLevel::info) << "Set  FruActiveLed: " << state;
 
     boardMs::LedStateType adaState = BoardManagerUtil::ProtoLedStateToMsLedState(state);
 
@@ -1855,58 +2056,35 @@ int BoardManager::HandleActiveLed(hal_common::LedState state)
 
 int BoardManager::HandleLedLocationTest(bool doTest)
 {
-    std::ostringstream  log;
-    log << "Do  LedLocationTest: " << doTest;
-    AddLog(__func__, __LINE__, log);
-    INFN_LOG(SeverityLevel::info) << log.str();
+    BRD_TRACE(mTrace, "Do LedLocationTest: %d", doTest);
+    INFN_LOG(SeverityLevel::info) << "Do  LedLocationTest: " << doTest;
 
     mspAdapter->DoLedLocationTest(doTest);
 
     return 0;
 }
 
-int BoardManager::HandlePortLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >& new_port_leds)
+int BoardManager::HandlePortLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >& new_port_leds,
+                                 boardMs::MezzLedStates& mezzLedStates)
 {
-    std::ostringstream  log;
-
     for(auto iter = new_port_leds.cbegin(); iter != new_port_leds.cend(); iter++)
     {
         const hal_common::PortLed& portLed = (*iter).second;
 
         boardMs::QSFPPortId portId = BoardManagerUtil::ProtoPortIdToMsPortId(portLed.port_id());
 
-        log << std::endl << "Proto PortId = " << hal_common::PortId_Name(portLed.port_id())
-            << " ;boardMS::QSFPPortId = " << boardMs::QSFPPortIdToStr(portId);
-        AddLog(__func__, __LINE__, log);
-        INFN_LOG(SeverityLevel::info) << log.str();
-        log.str("");
-
         if (portId != boardMs::QSFP_PORT_ID_INVALID)
         {
             if (portLed.port_active_led() != hal_common::LED_STATE_UNSPECIFIED)
             {
-                boardMs::LedStateType active_led = BoardManagerUtil::ProtoLedStateToMsLedState(portLed.port_active_led());
-
-                mspAdapter->SetPortLedState(portId, boardMs::QSFP_ACTIVE, active_led);
-
-                log << "Set Active LED for: " << hal_common::PortId_Name(portLed.port_id())
-                    << " to: " <<  hal_common::LedState_Name(portLed.port_active_led());
-                AddLog(__func__, __LINE__, log);
-                INFN_LOG(SeverityLevel::info) << log.str();
-                log.str("");
+                mezzLedStates.maQsfpLedStates[boardMs::QSFP_ACTIVE][portId] =
+                    BoardManagerUtil::ProtoLedStateToMsLedState(portLed.port_active_led());
             }
 
             if (portLed.port_los_led() != hal_common::LED_STATE_UNSPECIFIED)
             {
-                boardMs::LedStateType los_led = BoardManagerUtil::ProtoLedStateToMsLedState(portLed.port_los_led());
-
-                mspAdapter->SetPortLedState(portId, boardMs::QSFP_LOS, los_led);
-
-                log << "Set Los LED for port: " << hal_common::PortId_Name(portLed.port_id())
-                    << " to: " <<  hal_common::LedState_Name(portLed.port_los_led());
-                AddLog(__func__, __LINE__, log);
-                INFN_LOG(SeverityLevel::info) << log.str();
-                log.str("");
+                mezzLedStates.maQsfpLedStates[boardMs::QSFP_LOS][portId] =
+                    BoardManagerUtil::ProtoLedStateToMsLedState(portLed.port_los_led());
             }
         }
     }
@@ -1914,48 +2092,27 @@ int BoardManager::HandlePortLeds(const google::protobuf::Map< google::protobuf::
     return 0;
 }
 
-int BoardManager::HandleLineLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::LineLed >& new_line_leds)
+int BoardManager::HandleLineLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::LineLed >& new_line_leds,
+                                 boardMs::MezzLedStates& mezzLedStates)
 {
-    std::ostringstream  log;
-
     for(auto iter = new_line_leds.cbegin(); iter != new_line_leds.cend(); iter++)
     {
         const hal_common::LineLed& lineLed = (*iter).second;
 
         boardMs::LineId lineId = BoardManagerUtil::ProtoLineIdToMsLineId(lineLed.line_id());
 
-        log << std::endl << "Proto LineId = " << hal_common::LineId_Name(lineLed.line_id())
-            << " ;boardMS::LineId = " << boardMs::LineIdToStr(lineId);
-        AddLog(__func__, __LINE__, log);
-        INFN_LOG(SeverityLevel::info) << log.str();
-        log.str("");
-
         if (lineId != boardMs::LINE_ID_INVALID)
         {
             if (lineLed.line_active_led() != hal_common::LED_STATE_UNSPECIFIED)
             {
-                boardMs::LedStateType active_led = BoardManagerUtil::ProtoLedStateToMsLedState(lineLed.line_active_led());
-
-                mspAdapter->SetLineLedState(lineId, boardMs::LINE_ACTIVE, active_led);
-
-                log << "Set Active LED for: " << hal_common::LineId_Name(lineLed.line_id())
-                    << " to: " <<  hal_common::LedState_Name(lineLed.line_active_led());
-                AddLog(__func__, __LINE__, log);
-                INFN_LOG(SeverityLevel::info) << log.str();
-                log.str("");
+                mezzLedStates.maLineLedStates[boardMs::LINE_ACTIVE][lineId] =
+                    BoardManagerUtil::ProtoLedStateToMsLedState(lineLed.line_active_led());
             }
 
             if (lineLed.line_los_led() != hal_common::LED_STATE_UNSPECIFIED)
             {
-                boardMs::LedStateType los_led = BoardManagerUtil::ProtoLedStateToMsLedState(lineLed.line_los_led());
-
-                mspAdapter->SetLineLedState(lineId, boardMs::LINE_LOS, los_led);
-
-                log << "Set Los LED for line: " << hal_common::LineId_Name(lineLed.line_id())
-                    << " to: " <<  hal_common::LedState_Name(lineLed.line_los_led());
-                AddLog(__func__, __LINE__, log);
-                INFN_LOG(SeverityLevel::info) << log.str();
-                log.str("");
+                mezzLedStates.maLineLedStates[boardMs::LINE_LOS][lineId] =
+                    BoardManagerUtil::ProtoLedStateToMsLedState(lineLed.line_los_led());
             }
         }
     }
@@ -1963,6 +2120,41 @@ int BoardManager::HandleLineLeds(const google::protobuf::Map< google::protobuf::
     return 0;
 }
 
+int BoardManager::HandleMezzLeds(const boardMs::MezzLedStates& mezzLedStates)
+{
+    uint32 numPortLeds = 0;
+    uint32 numLineLeds = 0;
+
+    for (auto& states : mezzLedStates.maQsfpLedStates)
+    {
+        for (auto state : states)
+        {
+            numPortLeds += (state != boardMs::LED_STATE_UNKNOWN);
+        }
+    }
+
+    for (auto& states : mezzLedStates.maLineLedStates)
+    {
+        for (auto state : states)
+        {
+            numLineLeds += (state != boardMs::LED_STATE_UNKNOWN);
+        }
+    }
+
+    if ((numPortLeds == 0) && (numLineLeds == 0))
+    {
+        return 0;
+    }
+
+    int ret = mspAdapter->SetMezzLedStates(mezzLedStates);
+
+    BRD_TRACE(mTrace, "Set MEZZ LEDs port: %d line: %d ret: %d", numPortLeds, numLineLeds, ret);
+    INFN_LOG(SeverityLevel::info) << "Set " << numPortLeds << " port LEDs and " << numLineLeds
+                                  << " line LEDs" << ((ret == 0) ? "" : " failed");
+
+    return ret;
+}
+
 void BoardManager::HandleBoardInitStateChange(chm6_common::Chm6BoardInitState* pBrdState)
 {
     string stateData;
@@ -2072,10 +2264,8 @@ void BoardManager::HandleDcoCardStateChange(chm6_common::Chm6DcoCardState* dcoSt
     {
         if (mDcoSyncReady != dcoStateMsg->sync_ready())
         {
-            std::ostringstream  log;
-            log << "mDcoSyncReady = " << mDcoSyncReady << " change to " << dcoStateMsg->sync_ready();
-            AddLog(__func__, __LINE__, log);
-            INFN_LOG(SeverityLevel::info) << log.str();
+            BRD_TRACE(mTrace, "mDcoSyncReady = %d change to %d", mDcoSyncReady, dcoStateMsg->sync_ready());
+            INFN_LOG(SeverityLevel::info) << "mDcoSyncReady = " << mDcoSyncReady << " change to " << dcoStateMsg->sync_ready();
         }
 
         mDcoSyncReady = dcoStateMsg->sync_ready();
@@ -2097,7 +2287,13 @@ void BoardManager::HandleDcoCardFault(chm6_common::Chm6DcoCardFault* dcoFaultMsg
 {
     if (dcoFaultMsg->has_hal())
     {
-        mDcoCardFault.MergeFrom(*dcoFaultMsg);
+        {
+            std::lock_guard<std::mutex> guard(mFaultInputLock);
+
+            mDcoCardFault.MergeFrom(*dcoFaultMsg);
+
+            mIsDcoCardFaultChanged = true;
+        }
 
         string data;
         MessageToJsonString(*dcoFaultMsg, &data);
@@ -2112,25 +2308,13 @@ void BoardManager::HandleDcoCardFault(chm6_common::Chm6DcoCardFault* dcoFaultMsg
 void BoardManager::HandleDcoCardPm(chm6_common::Chm6DcoCardPm* dcoPmMsg)
 {
 
-    mDcoCardPm.CopyFrom(*dcoPmMsg);
-
-    mupBoardPm->clear_hal();
-
-    // Copy dco pm first
-    mupBoardPm->mutable_hal()->CopyFrom(dcoPmMsg->dco_pm());
-
-    // Add in board pm
-    UpdateBoardPm();
-
-    AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectStream(*(mupBoardPm.get()));
+    std::lock_guard<std::mutex> guard(mBoardPmLock);
 
-    if (mFirstPm == true)
+    // Cache dco pm; existing entries are updated in place
+    // Published with the board pm on the next strobe
+    for (auto &it : dcoPmMsg->dco_pm().pm())
     {
-        std::string pm_data;
-        MessageToJsonString(*(mupBoardPm.get()), &pm_data);
-        INFN_LOG(SeverityLevel::info) << "First update: " << pm_data;
-
-        mFirstPm = false;
+        mupPmBuilder->SetData(it.first, it.second);
     }
 }
 
@@ -2138,7 +2322,11 @@ void BoardManager::UpdateBoardInitFaults(chm6_common::Chm6BoardInitState* pBrdSt
 {
     INFN_LOG(SeverityLevel::info) << "";
 
+    std::lock_guard<std::mutex> guard(mFaultInputLock);
+
     mBoardInitFault.CopyFrom(pBrdState->init_fault());
+
+    mIsBoardInitFaultChanged = true;
 }
 
 void BoardManager::ResetBoardConfig()
@@ -2283,13 +2471,173 @@ void BoardManager::SendBoardStateToRedis(chm6_board::Chm6BoardState& boardState)
 
     boardState.mutable_base_state()->CopyFrom(*base_state);
 
-    AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(*(mupBoardState.get()));
+    if (mIsDeltaPublishEn && !mIsStateFullSyncReq)
+    {
+        AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(boardState);
+    }
+    else
+    {
+        AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectUpdate(*(mupBoardState.get()));
+
+        mIsStateFullSyncReq = false;
+    }
+
+    mNumStateWrites++;
 
     std::string state_data;
     MessageToJsonString(boardState, &state_data);
     INFN_LOG(SeverityLevel::info) << state_data;
 }
 
+void BoardManager::QueueBoardStateDelta(const chm6_board::Chm6BoardState& boardState)
+{
+    mBoardStateDelta.MergeFrom(boardState);
+
+    mNumStateDeltaSources++;
+    mNumStateDeltaQueued++;
+}
+
+void BoardManager::FlushBoardStateDelta()
+{
+    // Hold changes until the first full state has been written
+    if (mFirstState)
+    {
+        return;
+    }
+
+    if (!mBoardStateDelta.has_hal() && !mIsStateFullSyncReq)
+    {
+        return;
+    }
+
+    if (mNumStateDeltaSources > 1)
+    {
+        INFN_LOG(SeverityLevel::debug) << "Coalesced " << mNumStateDeltaSources << " state changes in one write";
+    }
+
+    SendBoardStateToRedis(mBoardStateDelta);
+
+    mBoardStateDelta.Clear();
+    mNumStateDeltaSources = 0;
+}
+
+void BoardManager::SetDeltaPublish(std::ostream& out, bool enable)
+{
+    out << "<<<<<<<<<<<<<<<<<<< BoardManager.SetDeltaPublish >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
+
+    std::lock_guard<std::mutex> guard(mBoardStateLock);
+
+    mIsDeltaPublishEn = enable;
+
+    // Bring Redis in line with the cache on the next tick
+    mIsStateFullSyncReq = true;
+
+    out << "Delta publish " << (enable ? "enabled" : "disabled") << std::endl;
+}
+
+void BoardManager::DumpPublishStats(std::ostream& out)
+{
+    out << "<<<<<<<<<<<<<<<<<<< BoardManager.DumpPublishStats >>>>>>>>>>>>>>>>>>>>>>" << endl << endl;
+
+    std::lock_guard<std::mutex> guard(mBoardStateLock);
+
+    out << "Delta publish     : " << (mIsDeltaPublishEn ? "enabled" : "disabled") << std::endl;
+    out << "State writes      : " << mNumStateWrites << std::endl;
+    out << "State changes     : " << mNumStateDeltaQueued << std::endl;
+    out << "Pending changes   : " << mNumStateDeltaSources << std::endl;
+    out << "Fault writes      : " << mNumFaultWrites << std::endl;
+
+    {
+        boost::unique_lock<boost::mutex> lock(mPm_strobe_cond_mutex);
+
+        out << "Pm strobes        : " << mNumPmStrobes << std::endl;
+        out << "Pm strobes missed : " << mNumPmStrobesMissed << std::endl;
+    }
+
+    std::lock_guard<std::mutex> pmGuard(mBoardPmLock);
+
+    out << "Pm writes         : " << mNumPmWrites << std::endl;
+    out << "Pm late writes    : " << mNumPmStrobesLate << " (> " << cPmStrobeLateMs << " ms)" << std::endl;
+    out << "Pm max latency    : " << mMaxPmStrobeLatencyMs << " ms" << std::endl;
+    out << "Pm bin writes     : " << mNumPmBinWrites << std::endl;
+}
+
+uint32 BoardManager::AddPmSlot(const std::string& key)
+{
+    uint32 slot = mupPmBuilder->AddSlot(key);
+
+    mupPmBinner->AddParam(slot, key);
+
+    return slot;
+}
+
+void BoardManager::SetPmValue(uint32 slot, float64 value)
+{
+    mupPmBuilder->SetValue(slot, value);
+
+    mupPmBinner->AddSample(slot, value);
+}
+
+void BoardManager::PublishPmBin(PmBinIntervalType interval)
+{
+    const PmBin* pBin = mupPmBinner->GetLastBin(interval);
+
+    if (pBin == nullptr)
+    {
+        return;
+    }
+
+    chm6_board::Chm6BoardPm binPm;
+
+    chm6_common::BasePm* base_pm = binPm.mutable_base_pm();
+
+    // .google.protobuf.StringValue config_id = 1;
+    base_pm->mutable_config_id()->set_value(mAid + "-" + BoardPmBinner::IntervalToStr(interval));
+    // .google.protobuf.Timestamp timestamp = 2;
+    base_pm->mutable_timestamp()->set_seconds(pBin->mEndTime);
+    base_pm->mutable_timestamp()->set_nanos(0);
+    // .google.protobuf.BoolValue mark_for_delete = 3;
+    base_pm->mutable_mark_for_delete()->set_value(false);
+
+    google::protobuf::Map< std::string, hal_common::PmType_PmDataType >* pmMap = binPm.mutable_hal()->mutable_pm();
+
+    auto addData = [pmMap](const std::string& key, float64 value)
+    {
+        hal_common::PmType_PmDataType& data = (*pmMap)[key];
+
+        data.mutable_pm_data_name()->set_value(key);
+        data.mutable_float_val()->set_value(value);
+        data.set_direction(hal_common::DIRECTION_NA);
+        data.set_location(hal_common::LOCATION_NA);
+    };
+
+    addData("bin_start_time", pBin->mStartTime);
+    addData("bin_partial", pBin->mIsPartial ? 1 : 0);
+
+    for (uint32 slot = 0; slot < pBin->mvStats.size() && slot < mupPmBinner->GetNumParams(); slot++)
+    {
+        const std::string& name  = mupPmBinner->GetParamName(slot);
+        const PmBinStats&  stats = pBin->mvStats[slot];
+
+        if (name.empty() || (stats.mNumSamples == 0))
+        {
+            continue;
+        }
+
+        addData(name + "_min",     stats.mMin);
+        addData(name + "_max",     stats.mMax);
+        addData(name + "_avg",     stats.GetAvg());
+        addData(name + "_last",    stats.mLast);
+        addData(name + "_samples", stats.mNumSamples);
+    }
+
+    AppServicerIntfSingleton::getInstance()->getRedisInstance()->RedisObjectStream(binPm);
+    mNumPmBinWrites++;
+
+    INFN_LOG(SeverityLevel::info) << "Published " << BoardPmBinner::IntervalToStr(interval)
+                                  << " pm bin ending " << pBin->mEndTime;
+}
+
 void BoardManager::RelayDcoCardConfigToDpMs(chm6_common::Chm6DcoConfig& dco_config)
 {
 
@@ -8,11 +8,20 @@
 
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <mutex>
+#include <array>
+#include <bitset>
+#include <map>
 
 #include "board_proto_defs.h"
 #include "board_adapter.h"
 #include "board_driver.h"
 #include "board_state_collector.h"
+#include "board_pm_builder.h"
+#include "board_pm_binner.h"
+#include "board_journal.h"
+#include "board_boot_prof.h"
+#include "board_init_fprint.h"
+#include "board_trace.h"
 #include "board_defs.h"
 #include "SimpleLog.h"
 
@@ -78,13 +87,17 @@ public:
 
     void onResync(chm6_common::Chm6BoardInitState* pBrdState);
 
-    // Called whenever pm strobe is ready
+    // Called whenever pm strobe is ready; the collector drives it every second
     void onPmStrobe();
 
     // BoardStateCollectWorker APIs
     void CollectFaults();
 
-    void CollectPm();
+    void CollectFaults(uint32 eventGroups);
+
+    bool WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups);
+
+    void CollectPm(const struct timespec& strobeTime);
 
     void CollectState();
 
@@ -103,6 +116,15 @@ public:
 
     void DumpBoardPm(std::ostream& out);
 
+    // Decode the persistent journal; ring is "event" or "pm"
+    void DumpJournal(std::ostream& out, std::string ring, uint32 numRecs);
+
+    // Latest board init phase timing against earlier boots of the same reason
+    void DumpBootProf(std::ostream& out, uint32 numBoots);
+
+    // Hardware init fingerprint board init saved for the next warm boot
+    void DumpInitFprint(std::ostream& out);
+
     // Reboot
     void SetRestartWarm(std::ostream& out);
 
@@ -112,6 +134,9 @@ public:
 
     void DumpSwVersion(std::ostream& out);
 
+    // Redis publishing mode: delta only (default) or full cached object
+    void SetDeltaPublish(std::ostream& out, bool enable);
+
 private:
 
     void CreateDataCache();
@@ -122,8 +147,37 @@ private:
 
     void CreateStateCollector();
 
+    /*
+     * Board fault cache entry, indexed by BoardFaultId.
+     * Published condition is the merge of adapter and board init conditions.
+     */
+    struct BoardFaultCacheEntry
+    {
+        BoardFaultCacheEntry()
+        : mCondition(boardMs::FAULT_UNKNOWN)
+        , mAdapterCondition(boardMs::FAULT_UNKNOWN)
+        , mInitCondition(boardMs::FAULT_UNKNOWN)
+        , mIsSimEn(false)
+        , mpFaultData(nullptr)
+        {}
+
+        uint8 mCondition;           // boardMs::faultConditionType as published
+        uint8 mAdapterCondition;
+        uint8 mInitCondition;
+        bool  mIsSimEn;
+
+        std::string mName;
+
+        // Entry in mupBoardFault, created on first change
+        hal_common::FaultType_FaultDataType* mpFaultData;
+    };
+
     void UpdateBoardFaults(chm6_board::Chm6BoardFault& boardFault);
 
+    void UpdateBoardInitFaultCache();
+
+    static uint8 MergeFaultCondition(const BoardFaultCacheEntry& entry);
+
     void UpdateBoardPm();
 
     void UpdateEqptStates(chm6_board::Chm6BoardState& boardState);
@@ -158,9 +212,13 @@ private:
 
     int HandleLedLocationTest(bool doTest);
 
-    int HandlePortLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >& new_port_leds);
+    int HandlePortLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::PortLed >& new_port_leds,
+                       boardMs::MezzLedStates& mezzLedStates);
 
-    int HandleLineLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::LineLed >& new_line_leds);
+    int HandleLineLeds(const google::protobuf::Map< google::protobuf::uint32, hal_common::LineLed >& new_line_leds,
+                       boardMs::MezzLedStates& mezzLedStates);
+
+    int HandleMezzLeds(const boardMs::MezzLedStates& mezzLedStates);
 
     void HandleBoardInitStateChange(chm6_common::Chm6BoardInitState* pBrdState);
 
@@ -184,6 +242,24 @@ private:
 
     void SendBoardStateToRedis(chm6_board::Chm6BoardState& boardState);
 
+    /*
+     * State changes are merged into mBoardStateDelta and published as one
+     * Redis write per collector tick. Caller holds mBoardStateLock.
+     */
+    void QueueBoardStateDelta(const chm6_board::Chm6BoardState& boardState);
+
+    void FlushBoardStateDelta();
+
+    void DumpPublishStats(std::ostream& out);
+
+    // PM entry that is also binned; caller holds mBoardPmLock
+    uint32 AddPmSlot(const std::string& key);
+
+    void SetPmValue(uint32 slot, float64 value);
+
+    // Stream the last completed bin of interval; caller holds mBoardPmLock
+    void PublishPmBin(PmBinIntervalType interval);
+
     void RelayDcoCardConfigToDpMs(chm6_common::Chm6DcoConfig& dco_config);
 
     std::string mAid;
@@ -204,11 +280,58 @@ private:
     std::unique_ptr<chm6_board::Chm6BoardState> mupBoardState;
     std::mutex    mBoardStateLock;
 
+    // State changes pending for the next Redis write
+    chm6_board::Chm6BoardState mBoardStateDelta;
+    uint32 mNumStateDeltaSources;
+
+    // Set when a change cannot be expressed as a delta (field removed)
+    bool mIsStateFullSyncReq;
+
+    bool mIsDeltaPublishEn;
+
+    uint64 mNumStateWrites;
+    uint64 mNumStateDeltaQueued;
+    uint64 mNumFaultWrites;
+
+    // Pm strobe; strobe counters under mPm_strobe_cond_mutex, rest under mBoardPmLock
+    uint64 mNumPmStrobes;
+    uint64 mNumPmStrobesMissed;
+    uint64 mNumPmWrites;
+    uint64 mNumPmStrobesLate;
+    sint32 mMaxPmStrobeLatencyMs;
+
+    uint64 mNumPmBinWrites;
+
     // Fault cache
     std::unique_ptr<chm6_board::Chm6BoardFault> mupBoardFault;
 
+    std::array<BoardFaultCacheEntry, boardMs::MAX_BOARD_FAULT_ID_NUM> maBoardFaultCache;
+
+    std::bitset<boardMs::MAX_BOARD_FAULT_ID_NUM> mBoardFaultDirty;
+
+    std::map<std::string, boardMs::BoardFaultId> mBoardFaultIdByName;
+
+    // Guards fault inputs from Redis callbacks: DCO card and board init faults
+    std::mutex mFaultInputLock;
+
+    bool mIsDcoCardFaultChanged;
+
+    bool mIsBoardInitFaultChanged;
+
+    bool mDcoHasFault;
+
     // PM cache
-    std::unique_ptr<chm6_board::Chm6BoardPm> mupBoardPm;
+    std::unique_ptr<BoardPmBuilder> mupPmBuilder;
+    std::mutex    mBoardPmLock;
+
+    std::vector<uint32> mvBoardPmSlots;
+
+    uint32 mDcoDspTempSlot;
+    uint32 mDcoPicTempSlot;
+    uint32 mDcoModuleCaseTempSlot;
+
+    // 15 min and 24 hr statistics of the binned PM slots
+    std::unique_ptr<BoardPmBinner> mupPmBinner;
 
     // Internal message cache
     chm6_common::Chm6TomPresenceMap mTomPresenceMap;
@@ -223,7 +346,6 @@ private:
 
     chm6_common::Chm6DcoCardFault mDcoCardFault;
 
-    chm6_common::Chm6DcoCardPm mDcoCardPm;
     hal_chm6::DcoPm mDcoPm; // TODO: remove later
 
     hal_common::UpgradableDeviceType mDcoUpgradableDevices;
@@ -247,6 +369,9 @@ private:
     SimpleLog::Log*  mpLog;
     mutable std::mutex    mLogLock;
 
+    // LED and DCO callback paths; see BRD_TRACE
+    BoardTraceRing mTrace;
+
     boost::thread mThrCli;
     bool mThrExit;
 
@@ -259,6 +384,9 @@ private:
 
     std::string mLastRebootTimestamp;
 
+    // Pm published later than this after its strobe is counted late
+    static const uint32 cPmStrobeLateMs = 500;
+
     static const std::string cEnvStrVerLc;
     static const std::string cEnvStrVerBaseOs;
     static const std::string cEnvStrVerBaseInfra;
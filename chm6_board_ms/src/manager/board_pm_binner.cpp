@@ -0,0 +1,207 @@
+/*
+ * board_pm_binner.cpp
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#include <utility>
+#include <boost/format.hpp>
+
+#include "board_pm_binner.h"
+
+const uint32 BoardPmBinner::cNumBins15Min;
+const uint32 BoardPmBinner::cNumBins24Hr;
+
+void PmBinStats::AddSample(float64 value)
+{
+    if ((mNumSamples == 0) || (value < mMin))
+    {
+        mMin = value;
+    }
+
+    if ((mNumSamples == 0) || (value > mMax))
+    {
+        mMax = value;
+    }
+
+    mSum  += value;
+    mLast  = value;
+    mNumSamples++;
+}
+
+BoardPmBinner::BoardPmBinner()
+{
+    maRing[PM_BIN_15_MIN].mIntervalSec = 15 * 60;
+    maRing[PM_BIN_15_MIN].mvBins.resize(cNumBins15Min);
+
+    maRing[PM_BIN_24_HR].mIntervalSec = 24 * 60 * 60;
+    maRing[PM_BIN_24_HR].mvBins.resize(cNumBins24Hr);
+}
+
+void BoardPmBinner::AddParam(uint32 slot, const std::string& name)
+{
+    if (slot >= mvParamNames.size())
+    {
+        mvParamNames.resize(slot + 1);
+    }
+
+    mvParamNames[slot] = name;
+
+    for (auto& ring : maRing)
+    {
+        if (ring.mCurBin.mvStats.size() < mvParamNames.size())
+        {
+            ring.mCurBin.mvStats.resize(mvParamNames.size());
+        }
+    }
+}
+
+uint32 BoardPmBinner::Roll(time_t now)
+{
+    uint32 completed = 0;
+
+    for (uint32 i = 0; i < NUM_PM_BIN_INTERVALS; i++)
+    {
+        BinRing& ring = maRing[i];
+        PmBin& curBin = ring.mCurBin;
+
+        if (curBin.mStartTime == 0)
+        {
+            StartBin(ring, now);
+            curBin.mIsPartial = (now != curBin.mStartTime);
+            continue;
+        }
+
+        if ((now >= curBin.mStartTime) && (now < curBin.mEndTime))
+        {
+            continue;
+        }
+
+        // Clock stepped if the next strobe is not in the following interval
+        bool isContiguous = (now >= curBin.mEndTime) &&
+                            (now < (time_t)(curBin.mEndTime + ring.mIntervalSec));
+
+        // Swap keeps the old ring entry's storage for the new bin
+        std::swap(ring.mvBins[ring.mNext], curBin);
+
+        ring.mNext = (ring.mNext + 1) % ring.mvBins.size();
+        ring.mNumCompleted++;
+
+        completed |= (1 << i);
+
+        StartBin(ring, now);
+        curBin.mIsPartial = !isContiguous;
+    }
+
+    return completed;
+}
+
+void BoardPmBinner::AddSample(uint32 slot, float64 value)
+{
+    if ((slot >= mvParamNames.size()) || mvParamNames[slot].empty())
+    {
+        return;
+    }
+
+    for (auto& ring : maRing)
+    {
+        ring.mCurBin.mvStats[slot].AddSample(value);
+    }
+}
+
+const PmBin* BoardPmBinner::GetLastBin(PmBinIntervalType interval) const
+{
+    if ((interval >= NUM_PM_BIN_INTERVALS) || (maRing[interval].mNumCompleted == 0))
+    {
+        return nullptr;
+    }
+
+    const BinRing& ring = maRing[interval];
+
+    uint32 last = (ring.mNext + ring.mvBins.size() - 1) % ring.mvBins.size();
+
+    return &ring.mvBins[last];
+}
+
+void BoardPmBinner::StartBin(BinRing& ring, time_t now)
+{
+    PmBin& bin = ring.mCurBin;
+
+    bin.mStartTime = now - (now % ring.mIntervalSec);
+    bin.mEndTime   = bin.mStartTime + ring.mIntervalSec;
+    bin.mIsPartial = false;
+
+    bin.mvStats.resize(mvParamNames.size());
+
+    for (auto& stats : bin.mvStats)
+    {
+        stats.Reset();
+    }
+}
+
+void BoardPmBinner::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardPmBinner.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    for (uint32 i = 0; i < NUM_PM_BIN_INTERVALS; i++)
+    {
+        const BinRing& ring = maRing[i];
+
+        os << "Interval: " << IntervalToStr(PmBinIntervalType(i))
+           << " Ring size: " << ring.mvBins.size()
+           << " Completed: " << ring.mNumCompleted << std::endl << std::endl;
+
+        os << "Current bin" << std::endl;
+        DumpBin(os, ring.mCurBin);
+
+        const PmBin* pLastBin = GetLastBin(PmBinIntervalType(i));
+
+        if (pLastBin)
+        {
+            os << "Last completed bin" << std::endl;
+            DumpBin(os, *pLastBin);
+        }
+    }
+}
+
+void BoardPmBinner::DumpBin(std::ostream& os, const PmBin& bin)
+{
+    os << "Start: " << bin.mStartTime << " End: " << bin.mEndTime
+       << " Partial: " << (bin.mIsPartial ? "yes" : "no") << std::endl;
+
+    os << boost::format("%-28s : %8s : %10s : %10s : %10s : %10s")
+          % "Name" % "Samples" % "Min" % "Max" % "Avg" % "Last" << std::endl;
+
+    for (uint32 slot = 0; slot < bin.mvStats.size() && slot < mvParamNames.size(); slot++)
+    {
+        if (mvParamNames[slot].empty())
+        {
+            continue;
+        }
+
+        const PmBinStats& stats = bin.mvStats[slot];
+
+        os << boost::format("%-28s : %8d : %10.3f : %10.3f : %10.3f : %10.3f")
+              % mvParamNames[slot]
+              % stats.mNumSamples
+              % stats.mMin
+              % stats.mMax
+              % stats.GetAvg()
+              % stats.mLast << std::endl;
+    }
+
+    os << std::endl;
+}
+
+std::string BoardPmBinner::IntervalToStr(PmBinIntervalType interval)
+{
+    switch (interval)
+    {
+        case PM_BIN_15_MIN:
+            return std::string("15min");
+        case PM_BIN_24_HR:
+            return std::string("24hr");
+        default:
+            return std::string("Unknown");
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * board_pm_binner.h
+ *
+ *  Created on: Oct 17, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BINNER_H_
+#define CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BINNER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ctime>
+
+#include "types.h"
+
+typedef enum PmBinIntervalType
+{
+    PM_BIN_15_MIN = 0,
+    PM_BIN_24_HR,
+    NUM_PM_BIN_INTERVALS
+} PmBinIntervalType;
+
+struct PmBinStats
+{
+    PmBinStats()
+    : mMin(0)
+    , mMax(0)
+    , mSum(0)
+    , mLast(0)
+    , mNumSamples(0)
+    {}
+
+    void Reset() { *this = PmBinStats(); }
+
+    void AddSample(float64 value);
+
+    float64 GetAvg() const { return (mNumSamples ? (mSum / mNumSamples) : 0); }
+
+    float64 mMin;
+    float64 mMax;
+    float64 mSum;
+    float64 mLast;
+    uint32  mNumSamples;
+};
+
+struct PmBin
+{
+    PmBin()
+    : mStartTime(0)
+    , mEndTime(0)
+    , mIsPartial(false)
+    {}
+
+    time_t mStartTime;
+    time_t mEndTime;
+
+    // Started after the interval boundary, e.g. first bin after boot
+    bool mIsPartial;
+
+    // Indexed by PM slot
+    std::vector<PmBinStats> mvStats;
+};
+
+/*
+ * Running min/max/avg/last per PM slot over the current 15 minute and
+ * 24 hour intervals. Intervals are aligned to wall clock (UTC). Completed
+ * bins go into a fixed size ring per interval; the storage is reused.
+ */
+class BoardPmBinner
+{
+public:
+
+    BoardPmBinner();
+
+    ~BoardPmBinner() {}
+
+    // Bin samples of slot under name; unnamed slots are ignored
+    void AddParam(uint32 slot, const std::string& name);
+
+    /*
+     * Close intervals that ended at or before now.
+     * Returns mask of (1 << PmBinIntervalType) with a newly completed bin.
+     */
+    uint32 Roll(time_t now);
+
+    void AddSample(uint32 slot, float64 value);
+
+    // Most recently completed bin; nullptr before the first one
+    const PmBin* GetLastBin(PmBinIntervalType interval) const;
+
+    const std::string& GetParamName(uint32 slot) const { return mvParamNames[slot]; }
+
+    uint32 GetNumParams() const { return mvParamNames.size(); }
+
+    void Dump(std::ostream& os);
+
+    static std::string IntervalToStr(PmBinIntervalType interval);
+
+    static const uint32 cNumBins15Min = 32; // 8 hours
+    static const uint32 cNumBins24Hr  = 7;
+
+private:
+
+    struct BinRing
+    {
+        BinRing()
+        : mIntervalSec(0)
+        , mNext(0)
+        , mNumCompleted(0)
+        {}
+
+        uint32 mIntervalSec;
+
+        PmBin mCurBin;
+
+        // Size fixed at construction
+        std::vector<PmBin> mvBins;
+
+        uint32 mNext;
+
+        uint64 mNumCompleted;
+    };
+
+    void StartBin(BinRing& ring, time_t now);
+
+    void DumpBin(std::ostream& os, const PmBin& bin);
+
+    BinRing maRing[NUM_PM_BIN_INTERVALS];
+
+    std::vector<std::string> mvParamNames;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BINNER_H_ */
@@ -0,0 +1,143 @@
+/*
+ * board_pm_builder.cpp
+ *
+ *  Created on: Oct 14, 2020
+ */
+
+#include "InfnLogger.h"
+#include "board_pm_builder.h"
+
+const uint32 BoardPmBuilder::cInvalidSlot;
+const uint32 BoardPmBuilder::cMaxArenaBytes;
+
+BoardPmBuilder::BoardPmBuilder(const std::string& aid)
+    : mpBoardPm(nullptr)
+    , mAid(aid)
+    , mNumCopies(0)
+    , mNumRebuilds(0)
+{
+    CreatePm();
+}
+
+uint32 BoardPmBuilder::AddSlot(const std::string& key)
+{
+    auto itr = mSlotByKey.find(key);
+
+    if (itr != mSlotByKey.end())
+    {
+        return itr->second;
+    }
+
+    uint32 slot = mvSlotKeys.size();
+
+    hal_common::PmType_PmDataType* pData = &(*mpBoardPm->mutable_hal()->mutable_pm())[key];
+
+    // .google.protobuf.StringValue pm_data_name = 1;
+    pData->mutable_pm_data_name()->set_value(key);
+    pData->mutable_float_val()->set_value(0);
+    pData->set_direction(hal_common::DIRECTION_NA);
+    pData->set_location(hal_common::LOCATION_NA);
+
+    mvSlotKeys.push_back(key);
+    mvpSlotData.push_back(pData);
+    mSlotByKey[key] = slot;
+
+    return slot;
+}
+
+void BoardPmBuilder::SetValue(uint32 slot, float64 value)
+{
+    if (slot >= mvpSlotData.size())
+    {
+        return;
+    }
+
+    // .google.protobuf.FloatValue float_val = 7;
+    mvpSlotData[slot]->mutable_float_val()->set_value(value);
+}
+
+void BoardPmBuilder::SetData(const std::string& key, const hal_common::PmType_PmDataType& data)
+{
+    auto itr = mSlotByKey.find(key);
+
+    if ((itr != mSlotByKey.end()) && data.has_float_val())
+    {
+        hal_common::PmType_PmDataType* pData = mvpSlotData[itr->second];
+
+        pData->mutable_float_val()->set_value(data.float_val().value());
+        pData->set_direction(data.direction());
+        pData->set_location(data.location());
+
+        return;
+    }
+
+    uint32 slot = AddSlot(key);
+
+    // Other data types are copied; copies allocate from the arena
+    mvpSlotData[slot]->CopyFrom(data);
+    mNumCopies++;
+
+    if (mArena.SpaceUsed() > cMaxArenaBytes)
+    {
+        Rebuild();
+    }
+}
+
+void BoardPmBuilder::SetTimestamp(time_t seconds, sint32 nanos)
+{
+    /*
+     * message Chm6BoardPm
+     * .infinera.chm6.common.vx.BasePm base_pm = 1;
+     */
+    chm6_common::BasePm* base_pm = mpBoardPm->mutable_base_pm();
+    // .google.protobuf.Timestamp timestamp = 2;
+    base_pm->mutable_timestamp()->set_seconds(seconds);
+    base_pm->mutable_timestamp()->set_nanos(nanos);
+}
+
+void BoardPmBuilder::Dump(std::ostream& os)
+{
+    os << "<<<<<<<<<<<<<<<<<<< BoardPmBuilder.Dump >>>>>>>>>>>>>>>>>>>>>>" << std::endl << std::endl;
+
+    os << "Slots       : " << mvSlotKeys.size() << std::endl;
+    os << "Arena bytes : " << mArena.SpaceUsed() << std::endl;
+    os << "Copies      : " << mNumCopies << std::endl;
+    os << "Rebuilds    : " << mNumRebuilds << std::endl;
+}
+
+void BoardPmBuilder::CreatePm()
+{
+    mpBoardPm = google::protobuf::Arena::CreateMessage<chm6_board::Chm6BoardPm>(&mArena);
+
+    chm6_common::BasePm* base_pm = mpBoardPm->mutable_base_pm();
+
+    // .google.protobuf.StringValue config_id = 1;
+    base_pm->mutable_config_id()->set_value(mAid);
+    // .google.protobuf.Timestamp timestamp = 2;
+    base_pm->mutable_timestamp()->set_seconds(time(NULL));
+    base_pm->mutable_timestamp()->set_nanos(0);
+    // .google.protobuf.BoolValue mark_for_delete = 3;
+    base_pm->mutable_mark_for_delete()->set_value(false);
+}
+
+void BoardPmBuilder::Rebuild()
+{
+    INFN_LOG(SeverityLevel::info) << "Rebuilding PM arena, bytes used: " << mArena.SpaceUsed();
+
+    chm6_board::Chm6BoardPm saved;
+    saved.CopyFrom(*mpBoardPm);
+
+    mArena.Reset();
+
+    mpBoardPm = google::protobuf::Arena::CreateMessage<chm6_board::Chm6BoardPm>(&mArena);
+    mpBoardPm->CopyFrom(saved);
+
+    google::protobuf::Map< std::string, hal_common::PmType_PmDataType >* pmMap = mpBoardPm->mutable_hal()->mutable_pm();
+
+    for (uint32 slot = 0; slot < mvSlotKeys.size(); ++slot)
+    {
+        mvpSlotData[slot] = &(*pmMap)[mvSlotKeys[slot]];
+    }
+
+    mNumRebuilds++;
+}
@@ -0,0 +1,76 @@
+/*
+ * board_pm_builder.h
+ *
+ *  Created on: Oct 14, 2020
+ */
+
+#ifndef CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BUILDER_H_
+#define CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BUILDER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <ctime>
+
+#include <google/protobuf/arena.h>
+
+#include "types.h"
+#include "board_proto_defs.h"
+
+/*
+ * Arena backed Chm6BoardPm.
+ * PM entries are created once per key; later cycles only update the
+ * value in place, so the streamed message is never reallocated.
+ */
+class BoardPmBuilder
+{
+public:
+
+    BoardPmBuilder(const std::string& aid);
+
+    ~BoardPmBuilder() {}
+
+    // Create entry for key once; returned slot is used by SetValue
+    uint32 AddSlot(const std::string& key);
+
+    void SetValue(uint32 slot, float64 value);
+
+    // Entry of any data type, e.g. relayed DCO PM. Float values in place
+    void SetData(const std::string& key, const hal_common::PmType_PmDataType& data);
+
+    void SetTimestamp(time_t seconds, sint32 nanos = 0);
+
+    chm6_board::Chm6BoardPm& GetPm() { return *mpBoardPm; }
+
+    void Dump(std::ostream& os);
+
+    static const uint32 cInvalidSlot = 0xFFFFFFFF;
+
+    // Arena is rebuilt when non float entries have grown it past this
+    static const uint32 cMaxArenaBytes = 256 * 1024;
+
+private:
+
+    void CreatePm();
+
+    void Rebuild();
+
+    google::protobuf::Arena mArena;
+
+    chm6_board::Chm6BoardPm* mpBoardPm;
+
+    std::string mAid;
+
+    std::vector<std::string> mvSlotKeys;
+
+    std::vector<hal_common::PmType_PmDataType*> mvpSlotData;
+
+    std::map<std::string, uint32> mSlotByKey;
+
+    uint64 mNumCopies;
+
+    uint64 mNumRebuilds;
+};
+
+#endif /* CHM6_BOARD_MS_SRC_MANAGER_BOARD_PM_BUILDER_H_ */
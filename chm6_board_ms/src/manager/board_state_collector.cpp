@@ -5,22 +5,30 @@
  */
 
 #include <boost/bind.hpp>
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
 #include <string>
 #include <iostream>
 
 #include "chm6/redis_adapter/application_servicer.h"
 #include "InfnLogger.h"
 #include "board_state_collector.h"
+#include "board_defs.h"
 
 BoardStateCollector::BoardStateCollector(BoardStateCollectWorker& worker,
                                          const std::string &name,
                                          int collectStateInterval,
                                          int collectFaultInterval,
-                                         bool first_run)
+                                         bool first_run,
+                                         bool isFaultEventMode,
+                                         int collectFaultSafetyNetInterval)
     : mrCollectWorker(worker)
     , mName(name)
     , mCollectStateInterval(collectStateInterval)
     , mCollectFaultInterval(collectFaultInterval)
+    , mIsFaultEventMode(isFaultEventMode)
+    , mCollectFaultSafetyNetInterval(collectFaultSafetyNetInterval)
     , mFirstRun(first_run)
     , mThrdExit(false)
 {
@@ -47,6 +55,18 @@ void BoardStateCollector::Collect()
 
     mThrFaults.detach();
 
+    mThrPm = boost::thread(boost::bind(
+            &BoardStateCollector::CollectBoardPm, this
+            ));
+
+    mThrPm.detach();
+
+    mThrPmStrobe = boost::thread(boost::bind(
+            &BoardStateCollector::GeneratePmStrobe, this
+            ));
+
+    mThrPmStrobe.detach();
+
     mThrState = boost::thread(boost::bind(
             &BoardStateCollector::CollectBoardStatus, this
             ));
@@ -65,6 +85,12 @@ bool BoardStateCollector::IsFirstRun()
 
 void BoardStateCollector::CollectBoardFaults()
 {
+    if (mIsFaultEventMode)
+    {
+        CollectBoardFaultEvents();
+        return;
+    }
+
     boost::posix_time::seconds workTime(mCollectFaultInterval);
 
      while (!mThrdExit)
@@ -77,31 +103,119 @@ void BoardStateCollector::CollectBoardFaults()
     INFN_LOG(SeverityLevel::info) << "Board faults Worker: finished";
 }
 
-void BoardStateCollector::CollectBoardPm()
+/*
+ * Faults with no event source keep the poll interval; the safety net
+ * only re-checks the groups interrupts already deliver.
+ */
+void BoardStateCollector::CollectBoardFaultEvents()
 {
-    while (true)
+    INFN_LOG(SeverityLevel::info) << "Board faults Worker: event mode, poll "
+                                  << mCollectFaultInterval << " seconds, safety net "
+                                  << mCollectFaultSafetyNetInterval << " seconds";
+
+    const uint32 cEventGroups = boardMs::cFaultEvtGrpHostDigital | boardMs::cFaultEvtGrpTmpAlert;
+
+    std::chrono::seconds pollTick(mCollectFaultInterval);
+    std::chrono::seconds safetyNet(mCollectFaultSafetyNetInterval);
+
+    auto nextPoll      = std::chrono::steady_clock::now();
+    auto nextSafetyNet = nextPoll;
+
+    while (!mThrdExit)
     {
-        boost::unique_lock<boost::mutex> lock(mrCollectWorker.mPm_strobe_cond_mutex);
+        auto now = std::chrono::steady_clock::now();
+
+        // Due even if events keep arriving
+        uint32 dueGroups = 0;
+
+        if (now >= nextPoll)
+        {
+            dueGroups |= boardMs::cFaultEvtGrpPolled;
+            nextPoll   = now + pollTick;
+        }
+
+        if (now >= nextSafetyNet)
+        {
+            dueGroups     |= cEventGroups;
+            nextSafetyNet  = now + safetyNet;
+        }
+
+        if (dueGroups)
+        {
+            mrCollectWorker.CollectFaults(dueGroups);
+            continue;
+        }
+
+        uint32 waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::min(nextPoll, nextSafetyNet) - now).count();
+
+        uint32 eventGroups = 0;
+
+        if (mrCollectWorker.WaitFaultEvent(waitMs, eventGroups))
+        {
+            mrCollectWorker.CollectFaults(eventGroups);
+        }
+    }
+
+    INFN_LOG(SeverityLevel::info) << "Board faults Worker: finished";
+}
 
-        while (!mrCollectWorker.mPm_strobe_ready)
+void BoardStateCollector::CollectBoardPm()
+{
+    boost::posix_time::seconds exitPoll(1);
+
+    while (!mThrdExit)
+    {
+        struct timespec strobeTime;
         {
-            mrCollectWorker.mPm_strobe_cond.wait(lock);
+            boost::unique_lock<boost::mutex> lock(mrCollectWorker.mPm_strobe_cond_mutex);
+
+            while (!mrCollectWorker.mPm_strobe_ready && !mThrdExit)
+            {
+                mrCollectWorker.mPm_strobe_cond.timed_wait(lock, exitPoll);
+            }
+
             if (mThrdExit)
             {
                 break;
             }
+
+            mrCollectWorker.mPm_strobe_ready = false;
+            strobeTime = mrCollectWorker.mPm_strobe_time;
         }
 
-        mrCollectWorker.mPm_strobe_ready = false;
-        mrCollectWorker.CollectPm();
+        // Sample outside the lock so the next strobe is never blocked
+        mrCollectWorker.CollectPm(strobeTime);
+    }
+
+    INFN_LOG(SeverityLevel::info) << "Board pm Worker: finished";
+}
+
+void BoardStateCollector::GeneratePmStrobe()
+{
+    INFN_LOG(SeverityLevel::info) << "Board pm strobe: local 1 second timer";
+
+    while (!mThrdExit)
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+
+        // On the second boundary so pm bins line up with wall clock
+        struct timespec next = { now.tv_sec + 1, 0 };
+
+        while ((clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &next, NULL) == EINTR) && !mThrdExit)
+        {
+        }
 
         if (mThrdExit)
         {
             break;
         }
+
+        mrCollectWorker.onPmStrobe();
     }
 
-    INFN_LOG(SeverityLevel::info) << "Board pm Worker: finished";
+    INFN_LOG(SeverityLevel::info) << "Board pm strobe: finished";
 }
 
 void BoardStateCollector::CollectBoardStatus()
@@ -9,19 +9,37 @@
 
 #include <boost/function.hpp>
 #include <boost/thread.hpp>
+#include <time.h>
+
+#include "types.h"
 
 class BoardStateCollectWorker
 {
 public:
 
     BoardStateCollectWorker()
-    : mPm_strobe_ready(false) {}
+    : mPm_strobe_ready(false)
+    , mPm_strobe_time{0, 0} {}
 
     virtual ~BoardStateCollectWorker() {}
 
     virtual void CollectFaults() {}
 
-    virtual void CollectPm() {}
+    // Collect only the fault groups named by a fault event
+    virtual void CollectFaults(uint32 eventGroups) { CollectFaults(); }
+
+    // Block until a fault event or timeout; returns false on timeout
+    virtual bool WaitFaultEvent(uint32 timeoutMs, uint32 &eventGroups)
+    {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(timeoutMs));
+        return false;
+    }
+
+    // Pm strobe; marks mPm_strobe_ready with the strobe time
+    virtual void onPmStrobe() {}
+
+    // One pm sample per strobe, stamped with the strobe time
+    virtual void CollectPm(const struct timespec& strobeTime) {}
 
     virtual void CollectState() {}
 
@@ -34,6 +52,9 @@ protected:
     boost::mutex mPm_strobe_cond_mutex;
 
     bool mPm_strobe_ready;
+
+    // Set with mPm_strobe_ready under mPm_strobe_cond_mutex
+    struct timespec mPm_strobe_time;
 };
 
 class BoardStateCollector
@@ -44,7 +65,9 @@ public:
                         const std::string &name,
                         int collectStateInterval,
                         int collectFaultInterval,
-                        bool first_run);
+                        bool first_run,
+                        bool isFaultEventMode = false,
+                        int collectFaultSafetyNetInterval = 0);
 
     ~BoardStateCollector();
 
@@ -58,8 +81,13 @@ private:
 
     void CollectBoardFaults();
 
+    void CollectBoardFaultEvents();
+
     void CollectBoardPm();
 
+    // Local pm strobe until one is subscribed from the chassis
+    void GeneratePmStrobe();
+
     void CollectBoardStatus();
 
     BoardStateCollectWorker& mrCollectWorker;
@@ -68,6 +96,8 @@ private:
 
     boost::thread mThrPm;
 
+    boost::thread mThrPmStrobe;
+
     boost::thread mThrState;
 
     std::string mName;
@@ -76,6 +106,11 @@ private:
 
     int mCollectFaultInterval;
 
+    // Event mode: faults collected on event, full poll as safety net
+    bool mIsFaultEventMode;
+
+    int mCollectFaultSafetyNetInterval;
+
     bool mFirstRun;
 
     bool mThrdExit;